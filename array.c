@@ -375,13 +375,59 @@ set_SUBSEP()
 }
 
 
+/*
+ * The node that concat_exp() builds array subscripts in.  While nothing
+ * else refers to it, the next subscript is built in the same node and
+ * buffer, so looking up an existing a[i, j] allocates nothing.  An array
+ * that installs a new element keeps the node as the element's name (see
+ * str_lookup); from then on it belongs to the array, and a new one is
+ * made here.
+ */
+static NODE *subs_node = NULL;
+
+/* subscript_node --- get a node with room for a subscript of len bytes */
+
+static NODE *
+subscript_node(size_t len)
+{
+	NODE *r = subs_node;
+
+	if (r != NULL && r->valref == 1) {
+		/* ours alone: forget any values left over from the last use */
+		mpfr_unset(r);
+		free_wstr(r);
+		r->flags = (MALLOC|STRING|STRCUR|STRCAP);
+		r->stfmt = -1;
+		r->numbr = 0;
+		/*
+		 * Also shrink a buffer left big by a long subscript, before
+		 * a new element can keep it for a short name.
+		 */
+		if (len + 2 > r->stcap || r->stcap > 4 * (len + 2) + 64) {
+			erealloc(r->stptr, char *, len + 2, "subscript_node");
+			r->stcap = len + 2;
+		}
+	} else {
+		if (r != NULL)
+			unref(r);	/* someone else has it now */
+		r = make_str_node("", 0, 0);
+		erealloc(r->stptr, char *, len + 2, "subscript_node");
+		r->stcap = len + 2;
+		r->flags |= STRCAP;
+		subs_node = r;
+	}
+	r->stlen = len;
+	UPREF(r);	/* for the caller */
+	return r;
+}
+
 /* concat_exp --- concatenate expression list into a single string */
 
 NODE *
 concat_exp(int nargs, bool do_subsep)
 {
 	/* do_subsep is false for Op_concat */
-	NODE *r;
+	NODE *r, *res = NULL;
 	char *str;
 	char *s;
 	size_t len;
@@ -409,7 +455,11 @@ concat_exp(int nargs, bool do_subsep)
 	}
 	len += (nargs - 1) * subseplen;
 
-	emalloc(str, char *, len + 2, "concat_exp");
+	if (do_subsep) {
+		res = subscript_node(len);
+		str = res->stptr;
+	} else
+		emalloc(str, char *, len + 2, "concat_exp");
 
 	r = args_array[nargs];
 	memcpy(str, r->stptr, r->stlen);
@@ -428,6 +478,10 @@ concat_exp(int nargs, bool do_subsep)
 		DEREF(r);
 	}
 
+	if (res != NULL) {
+		str[len] = '\0';
+		return res;
+	}
 	return make_str_node(str, len, ALREADY_MALLOCED);
 }
 
@@ -873,7 +927,7 @@ asort_actual(int nargs, SORT_CTXT ctxt)
 		/* We want the values of the source array. */
 
 		for (i = 1, ptr = list; i <= num_elems; i++) {
-			subs = make_number(i);
+			subs = make_unshared_number(i);
 
 			/* free index node */
 			r = *ptr++;
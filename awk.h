@@ -233,6 +233,7 @@ typedef struct Regexp {
 	short non_empty;	/* for use in fpat_parse_field */
 	short has_meta;		/* re has meta chars so (probably) isn't simple string */
 	short maybe_long;	/* re has meta chars that can match long text */
+	struct re_scanner *scanner;	/* see make_scanner() */
 } Regexp;
 #define	RESTART(rp,s)	(rp)->regs.start[0]
 #define	REEND(rp,s)	(rp)->regs.end[0]
@@ -397,6 +398,7 @@ typedef struct exp_node {
 #endif
 			char *sp;
 			size_t slen;
+			size_t scap;
 			long sref;
 			int idx;
 #if MBS_SUPPORT
@@ -428,6 +430,7 @@ typedef struct exp_node {
 #		define	MPFN	0x0800       /* arbitrary-precision floating-point number */
 #		define	MPZN	0x1000       /* arbitrary-precision integer */
 #		define	NO_EXT_SET 0x2000    /* extension cannot set a value for this variable */
+#		define	STRCAP	0x20000      /* stptr has room for stcap bytes */
 
 /* type = Node_var_array */
 #		define	ARRAYMAXED	0x4000       /* array is at max size */
@@ -463,6 +466,7 @@ typedef struct exp_node {
 /* Node_val */
 #define stptr	sub.val.sp
 #define stlen	sub.val.slen
+#define stcap	sub.val.scap
 #define valref	sub.val.sref
 #define stfmt	sub.val.idx
 #define wstptr	sub.val.wsp
@@ -566,6 +570,7 @@ typedef enum opcodeval {
 	Op_postdecrement,
 	Op_unary_minus,
 	Op_field_spec,
+	Op_field_spec_i,	/* $n for a constant n */
 
 	/* unary relationals */
 	Op_not,
@@ -575,6 +580,8 @@ typedef enum opcodeval {
 	Op_store_var,		/* simple variable assignment optimization */
 	Op_store_sub,		/* array[subscript] assignment optimization */
 	Op_store_field,  	/* $n assignment optimization */
+	Op_store_plus,		/* var += x, var++ and so on as a statement */
+	Op_store_sub_plus,	/* array[subscript] += x, array[subscript]++, ... */
 	Op_assign_times,
 	Op_assign_quotient,
 	Op_assign_mod,
@@ -591,7 +598,9 @@ typedef enum opcodeval {
 
 	/* binary relationals */
 	Op_equal,
+	Op_equal_i,		/* compare with a constant */
 	Op_notequal,
+	Op_notequal_i,
 	Op_less,
 	Op_greater,
 	Op_leq,
@@ -627,6 +636,8 @@ typedef enum opcodeval {
 	/* function call instruction */
 	Op_func_call,
 	Op_indirect_func_call,
+	Op_inline_enter,	/* start of an inlined call, see awkgram.y */
+	Op_inline_leave,	/* end of an inlined call */
 
 	Op_push,		/* scalar variable */
 	Op_push_arg,		/* variable type (scalar or array) argument to built-in */
@@ -702,6 +713,7 @@ typedef struct exp_instruction {
 		awk_value_t *(*efptr)(int, awk_value_t *);
 		long dl;
 		char *name;
+		struct indirect_cache *ic;
 	} d;
 
 	union {
@@ -794,9 +806,16 @@ typedef struct exp_instruction {
 /* Op_func_call, Op_func */
 #define func_body       x.xn
 
+/* Op_inline_enter, Op_inline_leave */
+#define inline_vars     d.dn	/* the callee's hidden parameter variables */
+#define target_call     d.di	/* (pc + 1): a real call, for odd arguments */
+
 /* Op_func_call */
 #define tail_call	d.dl
 
+/* Op_indirect_func_call, in (pc + 1) */
+#define call_cache	d.ic
+
 /* Op_subscript */
 #define sub_count       d.dl
 
@@ -862,7 +881,7 @@ typedef struct exp_instruction {
 #define condpair_left   d.di
 #define condpair_right  x.xi 
 
-/* Op_store_var */
+/* Op_store_var, Op_store_plus, Op_store_sub_plus */
 #define initval         x.xn
 
 typedef struct iobuf {
@@ -877,6 +896,14 @@ typedef struct iobuf {
 	ssize_t count;          /* amount read last time */
 	size_t scanoff;         /* where we were in the buffer when we had
 				   to regrow/refill */
+	off_t mapoff;		/* file offset of buf, if IOP_MMAPPED */
+	size_t maplen;		/* size of the mapping, if IOP_MMAPPED */
+	char *recbuf;		/* private copy of a mapped record and RT */
+	size_t recsize;		/* size of recbuf */
+	struct read_ahead *readahead;	/* helper thread state, see io.c */
+	char *rsblock;		/* 64 bytes already searched by rs1scan() */
+	uint64_t rsmask;	/* bit i set if rsblock[i] is rschar */
+	int rschar;		/* the RS that rsmask was built for */
 	/*
 	 * No argument prototype on read_func. See get_src_buf()
 	 * in awkgram.y.
@@ -891,6 +918,8 @@ typedef struct iobuf {
 #		define  IOP_AT_EOF      2
 #		define  IOP_CLOSED      4
 #		define  IOP_AT_START    8
+#		define  IOP_MMAPPED     16
+#		define  IOP_READ_AHEAD  32
 } IOBUF;
 
 typedef void (*Func_ptr)(void);
@@ -1027,6 +1056,7 @@ extern int sourceline;
 extern char *source;
 extern int (*interpret)(INSTRUCTION *);	/* interpreter routine */
 extern NODE *(*make_number)(double);	/* double instead of AWKNUM on purpose */
+extern NODE *(*make_unshared_number)(double);
 extern NODE *(*str2number)(NODE *);
 extern NODE *(*format_val)(const char *, int, NODE *);
 extern int (*cmp_numbers)(const NODE *, const NODE *);
@@ -1039,6 +1069,8 @@ extern NODE *_r;	/* used as temporary in macros */
 
 extern BLOCK nextfree[];
 extern bool field0_valid;
+extern long max_field_ref;
+extern bool dyn_field_ref;
 
 extern int do_flags;
 
@@ -1057,7 +1089,8 @@ enum do_flag_values {
 	DO_SANDBOX	= 0x0800,	/* sandbox mode - disable 'system' function & redirections */
 	DO_PROFILE	= 0x1000,	/* profile the program */
 	DO_DEBUG	= 0x2000,	/* debug the program */
-	DO_MPFR		= 0x4000	/* arbitrary-precision floating-point math */
+	DO_MPFR		= 0x4000,	/* arbitrary-precision floating-point math */
+	DO_CSV		= 0x8000	/* process comma-separated-value files */
 };
 
 #define do_traditional      (do_flags & DO_TRADITIONAL)
@@ -1072,8 +1105,9 @@ enum do_flag_values {
 #define do_sandbox          (do_flags & DO_SANDBOX)
 #define do_debug            (do_flags & DO_DEBUG)
 #define do_mpfr             (do_flags & DO_MPFR)
+#define do_csv              (do_flags & DO_CSV)
 
-extern bool do_optimize;
+extern int do_optimize;
 extern int use_lc_numeric;
 extern int exit_val;
 
@@ -1162,6 +1196,24 @@ extern STACK_ITEM *stack_top;
 #define POP_NUMBER() force_number(POP_SCALAR())
 #define TOP_NUMBER() force_number(TOP_SCALAR())
 
+/*
+ * REPLACE_NUMBER --- replace the number t on top of the stack with the
+ * result of an arithmetic operation.  A plain number that nothing but
+ * the stack refers to, such as the result of the previous operation,
+ * takes the new value in place instead of being freed and replaced
+ * by a new node.
+ */
+
+#define REPLACE_NUMBER(t, val)	do { \
+	if ((t)->valref == 1 && (t)->flags == (MALLOC|NUMCUR|NUMBER)) \
+		(t)->numbr = (val); \
+	else { \
+		NODE *_n = make_number(val); \
+		DEREF(t); \
+		REPLACE(_n); \
+	} \
+} while (false)
+
 /* ------------------------- Pseudo-functions ------------------------- */
 #ifdef HAVE_MPFR
 /* conversion to C types */
@@ -1404,9 +1456,11 @@ extern AWKNUM calc_exp(AWKNUM x1, AWKNUM x2);
 extern const char *opcode2str(OPCODE type);
 extern const char *op2str(OPCODE type);
 extern NODE **r_get_lhs(NODE *n, bool reference);
+extern void free_indirect_cache(struct indirect_cache *ic);
 extern STACK_ITEM *grow_stack(void);
 extern void dump_fcall_stack(FILE *fp);
 extern int register_exec_hook(Func_pre_exec preh, Func_post_exec posth);
+extern void dump_op_pairs(void);
 /* ext.c */
 void load_ext(const char *lib_name);
 #ifdef DYNAMIC
@@ -1421,6 +1475,7 @@ extern void init_fields(void);
 extern void set_record(const char *buf, int cnt);
 extern void reset_record(void);
 extern void set_NF(void);
+extern void count_NF(void);
 extern NODE **get_field(long num, Func_ptr *assign);
 extern NODE *do_split(int nargs);
 extern NODE *do_patsplit(int nargs);
@@ -1468,6 +1523,7 @@ extern void register_output_wrapper(awk_output_wrapper_t *wrapper);
 extern void register_two_way_processor(awk_two_way_processor_t *processor);
 extern void set_FNR(void);
 extern void set_NR(void);
+extern void input_map_fault(void);
 
 extern struct redirect *redirect(NODE *redir_exp, int redirtype, int *errflg);
 extern NODE *do_close(int nargs);
@@ -1481,6 +1537,9 @@ extern NODE *do_getline(int intovar, IOBUF *iop);
 extern struct redirect *getredirect(const char *str, int len);
 extern int inrec(IOBUF *iop, int *errcode);
 extern int nextfile(IOBUF **curfile, bool skipping);
+extern uint64_t (*byte_mask)(const char *p, int c);
+extern uint64_t (*byte_mask3)(const char *p, int c1, int c2, int c3);
+extern bool byte_is_char(int c);
 /* main.c */
 extern int arg_assign(char *arg, bool initing);
 extern int is_std_var(const char *var);
@@ -1548,6 +1607,7 @@ extern NODE *r_force_number(NODE *n);
 extern NODE *r_format_val(const char *format, int index, NODE *s);
 extern NODE *r_dupnode(NODE *n);
 extern NODE *make_str_node(const char *s, size_t len, int flags);
+extern NODE *make_char_node(int c);
 extern void *more_blocks(int id);
 extern void r_unref(NODE *tmp);
 extern int parse_escape(const char **string_ptr);
@@ -1572,6 +1632,9 @@ extern void init_btowc_cache();
 extern Regexp *make_regexp(const char *s, size_t len, bool ignorecase, bool dfa, bool canfatal);
 extern int research(Regexp *rp, char *str, int start, size_t len, int flags);
 extern void refree(Regexp *rp);
+extern void make_scanner(Regexp *rp, const char *s, size_t len);
+extern int scan_regexp(Regexp *rp, const char *str, size_t len, size_t *endp);
+extern bool scanner_useful(Regexp *rp, char *str, size_t len);
 extern void reg_error(const char *s);
 extern Regexp *re_update(NODE *t);
 extern void resyntax(int syntax);
@@ -1598,6 +1661,7 @@ extern void release_all_vars(void);
 extern int foreach_func(NODE **table, int (*)(INSTRUCTION *, void *), void *);
 extern INSTRUCTION *bcalloc(OPCODE op, int size, int srcline);
 extern void bcfree(INSTRUCTION *);
+extern void free_bc_list(INSTRUCTION *list);
 extern AWK_CONTEXT *new_context(void);
 extern void push_context(AWK_CONTEXT *ctxt);
 extern void pop_context();
@@ -1757,3 +1821,47 @@ dupnode(NODE *n)
 	return r_dupnode(n);
 }
 #endif
+
+/* count_bits --- number of bits set in a byte_mask() result */
+
+static inline int
+count_bits(uint64_t mask)
+{
+#ifdef __GNUC__
+	return __builtin_popcountll(mask);
+#else
+	int n;
+
+	for (n = 0; mask != 0; n++)
+		mask &= mask - 1;
+	return n;
+#endif
+}
+
+/* lowest_bit --- index of the lowest set bit in a nonzero byte_mask() result */
+
+static inline int
+lowest_bit(uint64_t mask)
+{
+#ifdef __GNUC__
+	return __builtin_ctzll(mask);
+#else
+	int i;
+
+	for (i = 0; (mask & 1) == 0; i++)
+		mask >>= 1;
+	return i;
+#endif
+}
+
+/*
+ * concat_capacity --- how much to allocate for a string of len bytes
+ * that is being built by appending to it: half again as much, so that
+ * repeated appends cost amortized constant time.
+ */
+
+static inline size_t
+concat_capacity(size_t len)
+{
+	return len + len / 2 + 16;
+}
@@ -1,21 +1,22 @@
-/* A Bison parser, made by GNU Bison 2.6.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
-   
-      Copyright (C) 1984, 1989-1990, 2000-2012 Free Software Foundation, Inc.
-   
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
    the Free Software Foundation, either version 3 of the License, or
    (at your option) any later version.
-   
+
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
    GNU General Public License for more details.
-   
+
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -26,13 +27,17 @@
    special exception, which will cause the skeleton and the resulting
    Bison output files to be licensed under the GNU General Public
    License without this special exception.
-   
+
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.6.5"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,7 @@
 
 
 
-/* Copy the first part of user declarations.  */
-/* Line 360 of yacc.c  */
+/* First part of user prologue.  */
 #line 26 "awkgram.y"
 
 #ifdef GAWKDEBUG
@@ -109,12 +113,19 @@ static INSTRUCTION *mk_for_loop(INSTRUCTION *forp, INSTRUCTION *init, INSTRUCTIO
 		INSTRUCTION *incr, INSTRUCTION *body);
 static void fix_break_continue(INSTRUCTION *list, INSTRUCTION *b_target, INSTRUCTION *c_target);
 static INSTRUCTION *mk_binary(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op);
+static bool fold_relop(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op);
+static INSTRUCTION *fold_builtin(INSTRUCTION *subn, INSTRUCTION *r, int nexp);
+static void const_regexp(INSTRUCTION *list);
+static bool ends_flow(INSTRUCTION *list);
 static INSTRUCTION *mk_boolean(INSTRUCTION *left, INSTRUCTION *right, INSTRUCTION *op);
 static INSTRUCTION *mk_assignment(INSTRUCTION *lhs, INSTRUCTION *rhs, INSTRUCTION *op);
 static INSTRUCTION *mk_getline(INSTRUCTION *op, INSTRUCTION *opt_var, INSTRUCTION *redir, int redirtype);
 static NODE *make_regnode(int type, NODE *exp);
 static int count_expressions(INSTRUCTION **list, bool isarg);
 static INSTRUCTION *optimize_assignment(INSTRUCTION *exp);
+static INSTRUCTION *optimize_plus_assign(INSTRUCTION *exp);
+static void fuse_field_refs(INSTRUCTION *list);
+static void inline_calls(INSTRUCTION *code);
 static void add_lint(INSTRUCTION *list, LINTTYPE linttype);
 
 static void process_deferred();
@@ -193,27 +204,31 @@ extern double fmod(double x, double y);
 
 #define YYSTYPE INSTRUCTION *
 
-/* Line 360 of yacc.c  */
-#line 198 "awkgram.c"
+#line 208 "awkgram.c"
 
-# ifndef YY_NULL
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULL nullptr
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
 #  else
-#   define YY_NULL 0
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
 
 
-/* Enabling traces.  */
+/* Debug traces.  */
 #ifndef YYDEBUG
 # define YYDEBUG 0
 #endif
@@ -221,66 +236,74 @@ extern double fmod(double x, double y);
 extern int yydebug;
 #endif
 
-/* Tokens.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     FUNC_CALL = 258,
-     NAME = 259,
-     REGEXP = 260,
-     FILENAME = 261,
-     YNUMBER = 262,
-     YSTRING = 263,
-     RELOP = 264,
-     IO_OUT = 265,
-     IO_IN = 266,
-     ASSIGNOP = 267,
-     ASSIGN = 268,
-     MATCHOP = 269,
-     CONCAT_OP = 270,
-     SUBSCRIPT = 271,
-     LEX_BEGIN = 272,
-     LEX_END = 273,
-     LEX_IF = 274,
-     LEX_ELSE = 275,
-     LEX_RETURN = 276,
-     LEX_DELETE = 277,
-     LEX_SWITCH = 278,
-     LEX_CASE = 279,
-     LEX_DEFAULT = 280,
-     LEX_WHILE = 281,
-     LEX_DO = 282,
-     LEX_FOR = 283,
-     LEX_BREAK = 284,
-     LEX_CONTINUE = 285,
-     LEX_PRINT = 286,
-     LEX_PRINTF = 287,
-     LEX_NEXT = 288,
-     LEX_EXIT = 289,
-     LEX_FUNCTION = 290,
-     LEX_BEGINFILE = 291,
-     LEX_ENDFILE = 292,
-     LEX_GETLINE = 293,
-     LEX_NEXTFILE = 294,
-     LEX_IN = 295,
-     LEX_AND = 296,
-     LEX_OR = 297,
-     INCREMENT = 298,
-     DECREMENT = 299,
-     LEX_BUILTIN = 300,
-     LEX_LENGTH = 301,
-     LEX_EOF = 302,
-     LEX_INCLUDE = 303,
-     LEX_EVAL = 304,
-     LEX_LOAD = 305,
-     NEWLINE = 306,
-     SLASH_BEFORE_EQUAL = 307,
-     UNARY = 308
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    FUNC_CALL = 258,               /* FUNC_CALL  */
+    NAME = 259,                    /* NAME  */
+    REGEXP = 260,                  /* REGEXP  */
+    FILENAME = 261,                /* FILENAME  */
+    YNUMBER = 262,                 /* YNUMBER  */
+    YSTRING = 263,                 /* YSTRING  */
+    RELOP = 264,                   /* RELOP  */
+    IO_OUT = 265,                  /* IO_OUT  */
+    IO_IN = 266,                   /* IO_IN  */
+    ASSIGNOP = 267,                /* ASSIGNOP  */
+    ASSIGN = 268,                  /* ASSIGN  */
+    MATCHOP = 269,                 /* MATCHOP  */
+    CONCAT_OP = 270,               /* CONCAT_OP  */
+    SUBSCRIPT = 271,               /* SUBSCRIPT  */
+    LEX_BEGIN = 272,               /* LEX_BEGIN  */
+    LEX_END = 273,                 /* LEX_END  */
+    LEX_IF = 274,                  /* LEX_IF  */
+    LEX_ELSE = 275,                /* LEX_ELSE  */
+    LEX_RETURN = 276,              /* LEX_RETURN  */
+    LEX_DELETE = 277,              /* LEX_DELETE  */
+    LEX_SWITCH = 278,              /* LEX_SWITCH  */
+    LEX_CASE = 279,                /* LEX_CASE  */
+    LEX_DEFAULT = 280,             /* LEX_DEFAULT  */
+    LEX_WHILE = 281,               /* LEX_WHILE  */
+    LEX_DO = 282,                  /* LEX_DO  */
+    LEX_FOR = 283,                 /* LEX_FOR  */
+    LEX_BREAK = 284,               /* LEX_BREAK  */
+    LEX_CONTINUE = 285,            /* LEX_CONTINUE  */
+    LEX_PRINT = 286,               /* LEX_PRINT  */
+    LEX_PRINTF = 287,              /* LEX_PRINTF  */
+    LEX_NEXT = 288,                /* LEX_NEXT  */
+    LEX_EXIT = 289,                /* LEX_EXIT  */
+    LEX_FUNCTION = 290,            /* LEX_FUNCTION  */
+    LEX_BEGINFILE = 291,           /* LEX_BEGINFILE  */
+    LEX_ENDFILE = 292,             /* LEX_ENDFILE  */
+    LEX_GETLINE = 293,             /* LEX_GETLINE  */
+    LEX_NEXTFILE = 294,            /* LEX_NEXTFILE  */
+    LEX_IN = 295,                  /* LEX_IN  */
+    LEX_AND = 296,                 /* LEX_AND  */
+    LEX_OR = 297,                  /* LEX_OR  */
+    INCREMENT = 298,               /* INCREMENT  */
+    DECREMENT = 299,               /* DECREMENT  */
+    LEX_BUILTIN = 300,             /* LEX_BUILTIN  */
+    LEX_LENGTH = 301,              /* LEX_LENGTH  */
+    LEX_EOF = 302,                 /* LEX_EOF  */
+    LEX_INCLUDE = 303,             /* LEX_INCLUDE  */
+    LEX_EVAL = 304,                /* LEX_EVAL  */
+    LEX_LOAD = 305,                /* LEX_LOAD  */
+    NEWLINE = 306,                 /* NEWLINE  */
+    SLASH_BEFORE_EQUAL = 307,      /* SLASH_BEFORE_EQUAL  */
+    UNARY = 308                    /* UNARY  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define FUNC_CALL 258
 #define NAME 259
 #define REGEXP 260
@@ -333,67 +356,256 @@ extern int yydebug;
 #define SLASH_BEFORE_EQUAL 307
 #define UNARY 308
 
-
-
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 typedef int YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
 # define YYSTYPE_IS_DECLARED 1
 #endif
 
+
 extern YYSTYPE yylval;
 
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
+
 int yyparse (void);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
 
-/* Copy the second part of user declarations.  */
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_FUNC_CALL = 3,                  /* FUNC_CALL  */
+  YYSYMBOL_NAME = 4,                       /* NAME  */
+  YYSYMBOL_REGEXP = 5,                     /* REGEXP  */
+  YYSYMBOL_FILENAME = 6,                   /* FILENAME  */
+  YYSYMBOL_YNUMBER = 7,                    /* YNUMBER  */
+  YYSYMBOL_YSTRING = 8,                    /* YSTRING  */
+  YYSYMBOL_RELOP = 9,                      /* RELOP  */
+  YYSYMBOL_IO_OUT = 10,                    /* IO_OUT  */
+  YYSYMBOL_IO_IN = 11,                     /* IO_IN  */
+  YYSYMBOL_ASSIGNOP = 12,                  /* ASSIGNOP  */
+  YYSYMBOL_ASSIGN = 13,                    /* ASSIGN  */
+  YYSYMBOL_MATCHOP = 14,                   /* MATCHOP  */
+  YYSYMBOL_CONCAT_OP = 15,                 /* CONCAT_OP  */
+  YYSYMBOL_SUBSCRIPT = 16,                 /* SUBSCRIPT  */
+  YYSYMBOL_LEX_BEGIN = 17,                 /* LEX_BEGIN  */
+  YYSYMBOL_LEX_END = 18,                   /* LEX_END  */
+  YYSYMBOL_LEX_IF = 19,                    /* LEX_IF  */
+  YYSYMBOL_LEX_ELSE = 20,                  /* LEX_ELSE  */
+  YYSYMBOL_LEX_RETURN = 21,                /* LEX_RETURN  */
+  YYSYMBOL_LEX_DELETE = 22,                /* LEX_DELETE  */
+  YYSYMBOL_LEX_SWITCH = 23,                /* LEX_SWITCH  */
+  YYSYMBOL_LEX_CASE = 24,                  /* LEX_CASE  */
+  YYSYMBOL_LEX_DEFAULT = 25,               /* LEX_DEFAULT  */
+  YYSYMBOL_LEX_WHILE = 26,                 /* LEX_WHILE  */
+  YYSYMBOL_LEX_DO = 27,                    /* LEX_DO  */
+  YYSYMBOL_LEX_FOR = 28,                   /* LEX_FOR  */
+  YYSYMBOL_LEX_BREAK = 29,                 /* LEX_BREAK  */
+  YYSYMBOL_LEX_CONTINUE = 30,              /* LEX_CONTINUE  */
+  YYSYMBOL_LEX_PRINT = 31,                 /* LEX_PRINT  */
+  YYSYMBOL_LEX_PRINTF = 32,                /* LEX_PRINTF  */
+  YYSYMBOL_LEX_NEXT = 33,                  /* LEX_NEXT  */
+  YYSYMBOL_LEX_EXIT = 34,                  /* LEX_EXIT  */
+  YYSYMBOL_LEX_FUNCTION = 35,              /* LEX_FUNCTION  */
+  YYSYMBOL_LEX_BEGINFILE = 36,             /* LEX_BEGINFILE  */
+  YYSYMBOL_LEX_ENDFILE = 37,               /* LEX_ENDFILE  */
+  YYSYMBOL_LEX_GETLINE = 38,               /* LEX_GETLINE  */
+  YYSYMBOL_LEX_NEXTFILE = 39,              /* LEX_NEXTFILE  */
+  YYSYMBOL_LEX_IN = 40,                    /* LEX_IN  */
+  YYSYMBOL_LEX_AND = 41,                   /* LEX_AND  */
+  YYSYMBOL_LEX_OR = 42,                    /* LEX_OR  */
+  YYSYMBOL_INCREMENT = 43,                 /* INCREMENT  */
+  YYSYMBOL_DECREMENT = 44,                 /* DECREMENT  */
+  YYSYMBOL_LEX_BUILTIN = 45,               /* LEX_BUILTIN  */
+  YYSYMBOL_LEX_LENGTH = 46,                /* LEX_LENGTH  */
+  YYSYMBOL_LEX_EOF = 47,                   /* LEX_EOF  */
+  YYSYMBOL_LEX_INCLUDE = 48,               /* LEX_INCLUDE  */
+  YYSYMBOL_LEX_EVAL = 49,                  /* LEX_EVAL  */
+  YYSYMBOL_LEX_LOAD = 50,                  /* LEX_LOAD  */
+  YYSYMBOL_NEWLINE = 51,                   /* NEWLINE  */
+  YYSYMBOL_SLASH_BEFORE_EQUAL = 52,        /* SLASH_BEFORE_EQUAL  */
+  YYSYMBOL_53_ = 53,                       /* '?'  */
+  YYSYMBOL_54_ = 54,                       /* ':'  */
+  YYSYMBOL_55_ = 55,                       /* ','  */
+  YYSYMBOL_56_ = 56,                       /* '<'  */
+  YYSYMBOL_57_ = 57,                       /* '>'  */
+  YYSYMBOL_58_ = 58,                       /* '+'  */
+  YYSYMBOL_59_ = 59,                       /* '-'  */
+  YYSYMBOL_60_ = 60,                       /* '*'  */
+  YYSYMBOL_61_ = 61,                       /* '/'  */
+  YYSYMBOL_62_ = 62,                       /* '%'  */
+  YYSYMBOL_63_ = 63,                       /* '!'  */
+  YYSYMBOL_UNARY = 64,                     /* UNARY  */
+  YYSYMBOL_65_ = 65,                       /* '^'  */
+  YYSYMBOL_66_ = 66,                       /* '$'  */
+  YYSYMBOL_67_ = 67,                       /* '('  */
+  YYSYMBOL_68_ = 68,                       /* ')'  */
+  YYSYMBOL_69_ = 69,                       /* '@'  */
+  YYSYMBOL_70_ = 70,                       /* '['  */
+  YYSYMBOL_71_ = 71,                       /* ']'  */
+  YYSYMBOL_72_ = 72,                       /* '{'  */
+  YYSYMBOL_73_ = 73,                       /* '}'  */
+  YYSYMBOL_74_ = 74,                       /* ';'  */
+  YYSYMBOL_YYACCEPT = 75,                  /* $accept  */
+  YYSYMBOL_program = 76,                   /* program  */
+  YYSYMBOL_rule = 77,                      /* rule  */
+  YYSYMBOL_source = 78,                    /* source  */
+  YYSYMBOL_library = 79,                   /* library  */
+  YYSYMBOL_pattern = 80,                   /* pattern  */
+  YYSYMBOL_action = 81,                    /* action  */
+  YYSYMBOL_func_name = 82,                 /* func_name  */
+  YYSYMBOL_lex_builtin = 83,               /* lex_builtin  */
+  YYSYMBOL_function_prologue = 84,         /* function_prologue  */
+  YYSYMBOL_regexp = 85,                    /* regexp  */
+  YYSYMBOL_86_1 = 86,                      /* $@1  */
+  YYSYMBOL_a_slash = 87,                   /* a_slash  */
+  YYSYMBOL_statements = 88,                /* statements  */
+  YYSYMBOL_statement_term = 89,            /* statement_term  */
+  YYSYMBOL_statement = 90,                 /* statement  */
+  YYSYMBOL_non_compound_stmt = 91,         /* non_compound_stmt  */
+  YYSYMBOL_92_2 = 92,                      /* $@2  */
+  YYSYMBOL_simple_stmt = 93,               /* simple_stmt  */
+  YYSYMBOL_94_3 = 94,                      /* $@3  */
+  YYSYMBOL_95_4 = 95,                      /* $@4  */
+  YYSYMBOL_opt_simple_stmt = 96,           /* opt_simple_stmt  */
+  YYSYMBOL_case_statements = 97,           /* case_statements  */
+  YYSYMBOL_case_statement = 98,            /* case_statement  */
+  YYSYMBOL_case_value = 99,                /* case_value  */
+  YYSYMBOL_print = 100,                    /* print  */
+  YYSYMBOL_print_expression_list = 101,    /* print_expression_list  */
+  YYSYMBOL_output_redir = 102,             /* output_redir  */
+  YYSYMBOL_103_5 = 103,                    /* $@5  */
+  YYSYMBOL_if_statement = 104,             /* if_statement  */
+  YYSYMBOL_nls = 105,                      /* nls  */
+  YYSYMBOL_opt_nls = 106,                  /* opt_nls  */
+  YYSYMBOL_input_redir = 107,              /* input_redir  */
+  YYSYMBOL_opt_param_list = 108,           /* opt_param_list  */
+  YYSYMBOL_param_list = 109,               /* param_list  */
+  YYSYMBOL_opt_exp = 110,                  /* opt_exp  */
+  YYSYMBOL_opt_expression_list = 111,      /* opt_expression_list  */
+  YYSYMBOL_expression_list = 112,          /* expression_list  */
+  YYSYMBOL_exp = 113,                      /* exp  */
+  YYSYMBOL_assign_operator = 114,          /* assign_operator  */
+  YYSYMBOL_relop_or_less = 115,            /* relop_or_less  */
+  YYSYMBOL_a_relop = 116,                  /* a_relop  */
+  YYSYMBOL_common_exp = 117,               /* common_exp  */
+  YYSYMBOL_simp_exp = 118,                 /* simp_exp  */
+  YYSYMBOL_simp_exp_nc = 119,              /* simp_exp_nc  */
+  YYSYMBOL_non_post_simp_exp = 120,        /* non_post_simp_exp  */
+  YYSYMBOL_func_call = 121,                /* func_call  */
+  YYSYMBOL_direct_func_call = 122,         /* direct_func_call  */
+  YYSYMBOL_opt_variable = 123,             /* opt_variable  */
+  YYSYMBOL_delete_subscript_list = 124,    /* delete_subscript_list  */
+  YYSYMBOL_delete_subscript = 125,         /* delete_subscript  */
+  YYSYMBOL_delete_exp_list = 126,          /* delete_exp_list  */
+  YYSYMBOL_bracketed_exp_list = 127,       /* bracketed_exp_list  */
+  YYSYMBOL_subscript = 128,                /* subscript  */
+  YYSYMBOL_subscript_list = 129,           /* subscript_list  */
+  YYSYMBOL_simple_variable = 130,          /* simple_variable  */
+  YYSYMBOL_variable = 131,                 /* variable  */
+  YYSYMBOL_opt_incdec = 132,               /* opt_incdec  */
+  YYSYMBOL_l_brace = 133,                  /* l_brace  */
+  YYSYMBOL_r_brace = 134,                  /* r_brace  */
+  YYSYMBOL_r_paren = 135,                  /* r_paren  */
+  YYSYMBOL_opt_semi = 136,                 /* opt_semi  */
+  YYSYMBOL_semi = 137,                     /* semi  */
+  YYSYMBOL_colon = 138,                    /* colon  */
+  YYSYMBOL_comma = 139                     /* comma  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
 
-/* Line 379 of yacc.c  */
-#line 367 "awkgram.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -401,16 +613,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -424,31 +648,71 @@ typedef short int yytype_int16;
 # endif
 #endif
 
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(N) (N)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int yyi)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (yyi)
-    int yyi;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return yyi;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
 #endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -465,8 +729,7 @@ YYID (yyi)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
       /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
 #     ifndef EXIT_SUCCESS
@@ -478,8 +741,8 @@ YYID (yyi)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -495,7 +758,7 @@ YYID (yyi)
 #  endif
 #  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
 #   ifndef EXIT_SUCCESS
 #    define EXIT_SUCCESS 0
@@ -503,38 +766,35 @@ YYID (yyi)
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined EXIT_SUCCESS && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
-#if (! defined yyoverflow      && (! defined __cplusplus 	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+#if (! defined yyoverflow      && (! defined __cplusplus          || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -544,16 +804,16 @@ union yyalloc
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack_alloc, Stack)				\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack_alloc, Stack, yysize);			\
-	Stack = &yyptr->Stack_alloc;					\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
@@ -563,16 +823,16 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
-      while (YYID (0))
+      while (0)
 #  endif
 # endif
 #endif /* !YYCOPY_NEEDED */
@@ -588,18 +848,23 @@ union yyalloc
 #define YYNNTS  65
 /* YYNRULES -- Number of rules.  */
 #define YYNRULES  188
-/* YYNRULES -- Number of states.  */
+/* YYNSTATES -- Number of states.  */
 #define YYNSTATES  335
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   308
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -635,273 +900,90 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint16 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     4,     7,    10,    13,    16,    19,    22,
-      25,    30,    35,    37,    40,    42,    44,    47,    49,    50,
-      52,    57,    59,    61,    63,    65,    71,    73,    75,    77,
-      80,    82,    84,    91,    92,    96,    98,   100,   101,   104,
-     107,   109,   112,   115,   119,   121,   131,   138,   147,   156,
-     169,   181,   183,   186,   189,   192,   195,   199,   200,   205,
-     208,   209,   214,   215,   220,   225,   227,   228,   230,   231,
-     234,   237,   243,   248,   250,   253,   256,   258,   260,   262,
-     264,   266,   270,   271,   272,   276,   283,   293,   295,   298,
-     299,   301,   302,   305,   306,   308,   310,   314,   316,   319,
-     323,   324,   326,   327,   329,   331,   335,   337,   340,   344,
-     348,   352,   356,   360,   364,   368,   372,   378,   380,   382,
-     384,   387,   389,   391,   393,   395,   397,   399,   402,   404,
-     408,   412,   416,   420,   424,   428,   432,   435,   438,   444,
-     449,   453,   457,   461,   465,   469,   473,   475,   478,   482,
-     487,   492,   494,   496,   498,   501,   504,   506,   508,   511,
-     514,   516,   519,   524,   525,   527,   528,   531,   533,   536,
-     538,   542,   544,   547,   550,   552,   555,   557,   561,   563,
-     565,   566,   569,   572,   574,   575,   577,   579,   581
+       0,   203,   203,   204,   209,   210,   216,   228,   232,   243,
+     249,   254,   262,   270,   272,   277,   285,   287,   293,   294,
+     296,   322,   333,   344,   350,   359,   369,   371,   373,   379,
+     384,   385,   389,   408,   407,   441,   443,   448,   449,   467,
+     472,   473,   477,   479,   481,   488,   578,   620,   662,   775,
+     782,   789,   799,   808,   817,   826,   837,   853,   852,   876,
+     888,   888,   986,   986,  1019,  1049,  1055,  1056,  1062,  1063,
+    1070,  1075,  1087,  1101,  1103,  1111,  1116,  1118,  1126,  1128,
+    1137,  1138,  1146,  1151,  1151,  1162,  1166,  1174,  1175,  1179,
+    1180,  1185,  1186,  1195,  1196,  1201,  1206,  1212,  1214,  1216,
+    1223,  1224,  1230,  1231,  1236,  1238,  1243,  1245,  1247,  1249,
+    1255,  1262,  1264,  1266,  1283,  1293,  1317,  1319,  1324,  1326,
+    1328,  1336,  1338,  1343,  1345,  1350,  1352,  1354,  1407,  1409,
+    1411,  1413,  1415,  1417,  1419,  1421,  1444,  1449,  1454,  1479,
+    1485,  1487,  1489,  1491,  1493,  1495,  1500,  1504,  1536,  1538,
+    1544,  1550,  1563,  1564,  1565,  1570,  1575,  1579,  1583,  1598,
+    1611,  1616,  1652,  1670,  1671,  1677,  1678,  1683,  1685,  1692,
+    1709,  1726,  1728,  1735,  1740,  1748,  1758,  1770,  1788,  1792,
+    1796,  1800,  1804,  1808,  1812,  1813,  1817,  1821,  1825
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int16 yyrhs[] =
-{
-      76,     0,    -1,    -1,    76,    77,    -1,    76,   105,    -1,
-      76,    47,    -1,    76,     1,    -1,    80,    81,    -1,    80,
-      89,    -1,    84,    81,    -1,    69,    48,    78,    89,    -1,
-      69,    50,    79,    89,    -1,     6,    -1,     6,     1,    -1,
-       1,    -1,     6,    -1,     6,     1,    -1,     1,    -1,    -1,
-     113,    -1,   113,    55,   106,   113,    -1,    17,    -1,    18,
-      -1,    36,    -1,    37,    -1,   133,    88,   134,   136,   106,
-      -1,     4,    -1,     3,    -1,    83,    -1,    69,    49,    -1,
-      45,    -1,    46,    -1,    35,    82,    67,   108,   135,   106,
-      -1,    -1,    87,    86,     5,    -1,    61,    -1,    52,    -1,
-      -1,    88,    90,    -1,    88,     1,    -1,   105,    -1,   137,
-     106,    -1,   137,   106,    -1,   133,    88,   134,    -1,   104,
-      -1,    23,    67,   113,   135,   106,   133,    97,   106,   134,
-      -1,    26,    67,   113,   135,   106,    90,    -1,    27,   106,
-      90,    26,    67,   113,   135,   106,    -1,    28,    67,     4,
-      40,   130,   135,   106,    90,    -1,    28,    67,    96,   137,
-     106,   113,   137,   106,    96,   135,   106,    90,    -1,    28,
-      67,    96,   137,   106,   137,   106,    96,   135,   106,    90,
-      -1,    91,    -1,    29,    89,    -1,    30,    89,    -1,    33,
-      89,    -1,    39,    89,    -1,    34,   110,    89,    -1,    -1,
-      21,    92,   110,    89,    -1,    93,    89,    -1,    -1,   100,
-      94,   101,   102,    -1,    -1,    22,     4,    95,   124,    -1,
-      22,    67,     4,    68,    -1,   113,    -1,    -1,    93,    -1,
-      -1,    97,    98,    -1,    97,     1,    -1,    24,    99,   138,
-     106,    88,    -1,    25,   138,   106,    88,    -1,     7,    -1,
-      59,     7,    -1,    58,     7,    -1,     8,    -1,    85,    -1,
-      31,    -1,    32,    -1,   111,    -1,    67,   112,   135,    -1,
-      -1,    -1,    10,   103,   117,    -1,    19,    67,   113,   135,
-     106,    90,    -1,    19,    67,   113,   135,   106,    90,    20,
-     106,    90,    -1,    51,    -1,   105,    51,    -1,    -1,   105,
-      -1,    -1,    56,   118,    -1,    -1,   109,    -1,     4,    -1,
-     109,   139,     4,    -1,     1,    -1,   109,     1,    -1,   109,
-     139,     1,    -1,    -1,   113,    -1,    -1,   112,    -1,   113,
-      -1,   112,   139,   113,    -1,     1,    -1,   112,     1,    -1,
-     112,     1,   113,    -1,   112,   139,     1,    -1,   131,   114,
-     113,    -1,   113,    41,   113,    -1,   113,    42,   113,    -1,
-     113,    14,   113,    -1,   113,    40,   130,    -1,   113,   116,
-     113,    -1,   113,    53,   113,    54,   113,    -1,   117,    -1,
-      13,    -1,    12,    -1,    52,    13,    -1,     9,    -1,    56,
-      -1,   115,    -1,    57,    -1,   118,    -1,   119,    -1,   117,
-     118,    -1,   120,    -1,   118,    65,   118,    -1,   118,    60,
-     118,    -1,   118,    61,   118,    -1,   118,    62,   118,    -1,
-     118,    58,   118,    -1,   118,    59,   118,    -1,    38,   123,
-     107,    -1,   131,    43,    -1,   131,    44,    -1,    67,   112,
-     135,    40,   130,    -1,   117,    11,    38,   123,    -1,   119,
-      65,   118,    -1,   119,    60,   118,    -1,   119,    61,   118,
-      -1,   119,    62,   118,    -1,   119,    58,   118,    -1,   119,
-      59,   118,    -1,    85,    -1,    63,   118,    -1,    67,   113,
-     135,    -1,    45,    67,   111,   135,    -1,    46,    67,   111,
-     135,    -1,    46,    -1,   121,    -1,   131,    -1,    43,   131,
-      -1,    44,   131,    -1,     7,    -1,     8,    -1,    59,   118,
-      -1,    58,   118,    -1,   122,    -1,    69,   122,    -1,     3,
-      67,   111,   135,    -1,    -1,   131,    -1,    -1,   125,    16,
-      -1,   126,    -1,   125,   126,    -1,   127,    -1,    70,   112,
-      71,    -1,   127,    -1,   128,   127,    -1,   128,    16,    -1,
-       4,    -1,     4,   129,    -1,   130,    -1,    66,   120,   132,
-      -1,    43,    -1,    44,    -1,    -1,    72,   106,    -1,    73,
-     106,    -1,    68,    -1,    -1,   137,    -1,    74,    -1,    54,
-      -1,    55,   106,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   195,   195,   197,   202,   203,   209,   221,   225,   236,
-     242,   247,   255,   263,   265,   270,   278,   280,   286,   287,
-     289,   315,   326,   337,   343,   352,   362,   364,   366,   372,
-     377,   378,   382,   401,   400,   434,   436,   441,   442,   455,
-     460,   461,   465,   467,   469,   476,   566,   608,   650,   763,
-     770,   777,   787,   796,   805,   814,   825,   841,   840,   864,
-     876,   876,   974,   974,  1007,  1037,  1043,  1044,  1050,  1051,
-    1058,  1063,  1075,  1089,  1091,  1099,  1104,  1106,  1114,  1116,
-    1125,  1126,  1134,  1139,  1139,  1150,  1154,  1162,  1163,  1166,
-    1168,  1173,  1174,  1183,  1184,  1189,  1194,  1200,  1202,  1204,
-    1211,  1212,  1218,  1219,  1224,  1226,  1231,  1233,  1235,  1237,
-    1243,  1250,  1252,  1254,  1270,  1280,  1287,  1289,  1294,  1296,
-    1298,  1306,  1308,  1313,  1315,  1320,  1322,  1324,  1374,  1376,
-    1378,  1380,  1382,  1384,  1386,  1388,  1411,  1416,  1421,  1446,
-    1452,  1454,  1456,  1458,  1460,  1462,  1467,  1471,  1503,  1505,
-    1511,  1517,  1530,  1531,  1532,  1537,  1542,  1546,  1550,  1565,
-    1578,  1583,  1619,  1637,  1638,  1644,  1645,  1650,  1652,  1659,
-    1676,  1693,  1695,  1702,  1707,  1715,  1725,  1737,  1746,  1750,
-    1754,  1758,  1762,  1766,  1769,  1771,  1775,  1779,  1783
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "FUNC_CALL", "NAME", "REGEXP",
-  "FILENAME", "YNUMBER", "YSTRING", "RELOP", "IO_OUT", "IO_IN", "ASSIGNOP",
-  "ASSIGN", "MATCHOP", "CONCAT_OP", "SUBSCRIPT", "LEX_BEGIN", "LEX_END",
-  "LEX_IF", "LEX_ELSE", "LEX_RETURN", "LEX_DELETE", "LEX_SWITCH",
-  "LEX_CASE", "LEX_DEFAULT", "LEX_WHILE", "LEX_DO", "LEX_FOR", "LEX_BREAK",
-  "LEX_CONTINUE", "LEX_PRINT", "LEX_PRINTF", "LEX_NEXT", "LEX_EXIT",
-  "LEX_FUNCTION", "LEX_BEGINFILE", "LEX_ENDFILE", "LEX_GETLINE",
-  "LEX_NEXTFILE", "LEX_IN", "LEX_AND", "LEX_OR", "INCREMENT", "DECREMENT",
-  "LEX_BUILTIN", "LEX_LENGTH", "LEX_EOF", "LEX_INCLUDE", "LEX_EVAL",
-  "LEX_LOAD", "NEWLINE", "SLASH_BEFORE_EQUAL", "'?'", "':'", "','", "'<'",
-  "'>'", "'+'", "'-'", "'*'", "'/'", "'%'", "'!'", "UNARY", "'^'", "'$'",
-  "'('", "')'", "'@'", "'['", "']'", "'{'", "'}'", "';'", "$accept",
-  "program", "rule", "source", "library", "pattern", "action", "func_name",
-  "lex_builtin", "function_prologue", "regexp", "$@1", "a_slash",
-  "statements", "statement_term", "statement", "non_compound_stmt", "$@2",
-  "simple_stmt", "$@3", "$@4", "opt_simple_stmt", "case_statements",
-  "case_statement", "case_value", "print", "print_expression_list",
-  "output_redir", "$@5", "if_statement", "nls", "opt_nls", "input_redir",
-  "opt_param_list", "param_list", "opt_exp", "opt_expression_list",
-  "expression_list", "exp", "assign_operator", "relop_or_less", "a_relop",
-  "common_exp", "simp_exp", "simp_exp_nc", "non_post_simp_exp",
-  "func_call", "direct_func_call", "opt_variable", "delete_subscript_list",
-  "delete_subscript", "delete_exp_list", "bracketed_exp_list", "subscript",
-  "subscript_list", "simple_variable", "variable", "opt_incdec", "l_brace",
-  "r_brace", "r_paren", "opt_semi", "semi", "colon", "comma", YY_NULL
+  "\"end of file\"", "error", "\"invalid token\"", "FUNC_CALL", "NAME",
+  "REGEXP", "FILENAME", "YNUMBER", "YSTRING", "RELOP", "IO_OUT", "IO_IN",
+  "ASSIGNOP", "ASSIGN", "MATCHOP", "CONCAT_OP", "SUBSCRIPT", "LEX_BEGIN",
+  "LEX_END", "LEX_IF", "LEX_ELSE", "LEX_RETURN", "LEX_DELETE",
+  "LEX_SWITCH", "LEX_CASE", "LEX_DEFAULT", "LEX_WHILE", "LEX_DO",
+  "LEX_FOR", "LEX_BREAK", "LEX_CONTINUE", "LEX_PRINT", "LEX_PRINTF",
+  "LEX_NEXT", "LEX_EXIT", "LEX_FUNCTION", "LEX_BEGINFILE", "LEX_ENDFILE",
+  "LEX_GETLINE", "LEX_NEXTFILE", "LEX_IN", "LEX_AND", "LEX_OR",
+  "INCREMENT", "DECREMENT", "LEX_BUILTIN", "LEX_LENGTH", "LEX_EOF",
+  "LEX_INCLUDE", "LEX_EVAL", "LEX_LOAD", "NEWLINE", "SLASH_BEFORE_EQUAL",
+  "'?'", "':'", "','", "'<'", "'>'", "'+'", "'-'", "'*'", "'/'", "'%'",
+  "'!'", "UNARY", "'^'", "'$'", "'('", "')'", "'@'", "'['", "']'", "'{'",
+  "'}'", "';'", "$accept", "program", "rule", "source", "library",
+  "pattern", "action", "func_name", "lex_builtin", "function_prologue",
+  "regexp", "$@1", "a_slash", "statements", "statement_term", "statement",
+  "non_compound_stmt", "$@2", "simple_stmt", "$@3", "$@4",
+  "opt_simple_stmt", "case_statements", "case_statement", "case_value",
+  "print", "print_expression_list", "output_redir", "$@5", "if_statement",
+  "nls", "opt_nls", "input_redir", "opt_param_list", "param_list",
+  "opt_exp", "opt_expression_list", "expression_list", "exp",
+  "assign_operator", "relop_or_less", "a_relop", "common_exp", "simp_exp",
+  "simp_exp_nc", "non_post_simp_exp", "func_call", "direct_func_call",
+  "opt_variable", "delete_subscript_list", "delete_subscript",
+  "delete_exp_list", "bracketed_exp_list", "subscript", "subscript_list",
+  "simple_variable", "variable", "opt_incdec", "l_brace", "r_brace",
+  "r_paren", "opt_semi", "semi", "colon", "comma", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,    63,    58,    44,    60,    62,    43,    45,
-      42,    47,    37,    33,   308,    94,    36,    40,    41,    64,
-      91,    93,   123,   125,    59
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    75,    76,    76,    76,    76,    76,    77,    77,    77,
-      77,    77,    78,    78,    78,    79,    79,    79,    80,    80,
-      80,    80,    80,    80,    80,    81,    82,    82,    82,    82,
-      83,    83,    84,    86,    85,    87,    87,    88,    88,    88,
-      89,    89,    90,    90,    90,    90,    90,    90,    90,    90,
-      90,    90,    91,    91,    91,    91,    91,    92,    91,    91,
-      94,    93,    95,    93,    93,    93,    96,    96,    97,    97,
-      97,    98,    98,    99,    99,    99,    99,    99,   100,   100,
-     101,   101,   102,   103,   102,   104,   104,   105,   105,   106,
-     106,   107,   107,   108,   108,   109,   109,   109,   109,   109,
-     110,   110,   111,   111,   112,   112,   112,   112,   112,   112,
-     113,   113,   113,   113,   113,   113,   113,   113,   114,   114,
-     114,   115,   115,   116,   116,   117,   117,   117,   118,   118,
-     118,   118,   118,   118,   118,   118,   118,   118,   118,   119,
-     119,   119,   119,   119,   119,   119,   120,   120,   120,   120,
-     120,   120,   120,   120,   120,   120,   120,   120,   120,   120,
-     121,   121,   122,   123,   123,   124,   124,   125,   125,   126,
-     127,   128,   128,   129,   130,   130,   131,   131,   132,   132,
-     132,   133,   134,   135,   136,   136,   137,   138,   139
-};
+#define YYPACT_NINF (-273)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
-       4,     4,     1,     2,     1,     1,     2,     1,     0,     1,
-       4,     1,     1,     1,     1,     5,     1,     1,     1,     2,
-       1,     1,     6,     0,     3,     1,     1,     0,     2,     2,
-       1,     2,     2,     3,     1,     9,     6,     8,     8,    12,
-      11,     1,     2,     2,     2,     2,     3,     0,     4,     2,
-       0,     4,     0,     4,     4,     1,     0,     1,     0,     2,
-       2,     5,     4,     1,     2,     2,     1,     1,     1,     1,
-       1,     3,     0,     0,     3,     6,     9,     1,     2,     0,
-       1,     0,     2,     0,     1,     1,     3,     1,     2,     3,
-       0,     1,     0,     1,     1,     3,     1,     2,     3,     3,
-       3,     3,     3,     3,     3,     3,     5,     1,     1,     1,
-       2,     1,     1,     1,     1,     1,     1,     2,     1,     3,
-       3,     3,     3,     3,     3,     3,     2,     2,     5,     4,
-       3,     3,     3,     3,     3,     3,     1,     2,     3,     4,
-       4,     1,     1,     1,     2,     2,     1,     1,     2,     2,
-       1,     2,     4,     0,     1,     0,     2,     1,     2,     1,
-       3,     1,     2,     2,     1,     2,     1,     3,     1,     1,
-       0,     2,     2,     1,     0,     1,     1,     1,     2
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
-   Performed when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-       2,     0,     1,     6,     0,   174,   156,   157,    21,    22,
-       0,    23,    24,   163,     0,     0,     0,   151,     5,    87,
-      36,     0,     0,    35,     0,     0,     0,     0,     3,     0,
-       0,   146,    33,     4,    19,   117,   125,   126,   128,   152,
-     160,   176,   153,     0,     0,   171,     0,   175,    27,    26,
-      30,    31,     0,     0,    28,    91,   164,   154,   155,     0,
-       0,     0,   159,   153,   158,   147,     0,   180,   153,   106,
-       0,   104,     0,     0,   161,    89,   186,     7,     8,    40,
-      37,    89,     9,     0,    88,   121,     0,     0,     0,     0,
-       0,    89,   122,   124,   123,     0,     0,   127,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     119,   118,   136,   137,     0,     0,     0,     0,   104,     0,
-     173,   172,    29,     0,     0,   135,     0,     0,     0,   178,
-     179,   177,   107,    89,   183,     0,     0,   148,    14,     0,
-       0,    17,     0,     0,    90,   181,     0,    41,    34,   113,
-     114,   111,   112,     0,     0,   115,   163,   133,   134,   130,
-     131,   132,   129,   144,   145,   141,   142,   143,   140,   120,
-     110,   162,   170,    97,    95,     0,     0,    92,   149,   150,
-     108,   188,     0,   109,   105,    13,    10,    16,    11,    39,
-       0,    57,     0,     0,     0,    89,     0,     0,     0,    78,
-      79,     0,   100,     0,    89,    38,    51,     0,    60,    44,
-      65,    37,   184,    89,     0,    20,   139,    89,    98,     0,
-     138,     0,   100,    62,     0,     0,     0,     0,    66,    52,
-      53,    54,     0,   101,    55,   182,    59,     0,     0,    89,
-     185,    42,   116,    32,    99,    96,     0,     0,   165,     0,
-       0,     0,     0,   174,    67,     0,    56,     0,    82,    80,
-      43,    25,    89,    58,    63,     0,   167,   169,    64,    89,
-      89,     0,     0,    89,     0,    83,    61,     0,   166,   168,
-       0,     0,     0,     0,     0,    81,     0,    85,    68,    46,
-       0,    89,     0,    89,    84,    89,     0,    89,     0,    89,
-      66,     0,    70,     0,     0,    69,     0,    47,    48,    66,
-       0,    86,    73,    76,     0,     0,    77,     0,   187,    89,
-      45,     0,    89,    75,    74,    89,    37,    89,     0,    37,
-       0,     0,    50,     0,    49
-};
+#define YYTABLE_NINF (-104)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
-{
-      -1,     1,    28,   140,   143,    29,    77,    53,    54,    30,
-      31,    83,    32,   146,    78,   205,   206,   222,   207,   237,
-     248,   255,   296,   305,   317,   208,   258,   276,   286,   209,
-     144,   145,   125,   175,   176,   232,   116,   117,   210,   115,
-      94,    95,    35,    36,    37,    38,    39,    40,    55,   264,
-     265,   266,    45,    46,    47,    41,    42,   131,   211,   212,
-     137,   239,   213,   319,   136
-};
+#define yytable_value_is_error(Yyn) \
+  ((Yyn) == YYTABLE_NINF)
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -273
 static const yytype_int16 yypact[] =
 {
     -273,   376,  -273,  -273,   -27,   -21,  -273,  -273,  -273,  -273,
@@ -940,6 +1022,47 @@ static const yytype_int16 yypact[] =
      448,   710,  -273,   522,  -273
 };
 
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       2,     0,     1,     6,     0,   174,   156,   157,    21,    22,
+       0,    23,    24,   163,     0,     0,     0,   151,     5,    87,
+      36,     0,     0,    35,     0,     0,     0,     0,     3,     0,
+       0,   146,    33,     4,    19,   117,   125,   126,   128,   152,
+     160,   176,   153,     0,     0,   171,     0,   175,    27,    26,
+      30,    31,     0,     0,    28,    91,   164,   154,   155,     0,
+       0,     0,   159,   153,   158,   147,     0,   180,   153,   106,
+       0,   104,     0,     0,   161,    89,   186,     7,     8,    40,
+      37,    89,     9,     0,    88,   121,     0,     0,     0,     0,
+       0,    89,   122,   124,   123,     0,     0,   127,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     119,   118,   136,   137,     0,     0,     0,     0,   104,     0,
+     173,   172,    29,     0,     0,   135,     0,     0,     0,   178,
+     179,   177,   107,    89,   183,     0,     0,   148,    14,     0,
+       0,    17,     0,     0,    90,   181,     0,    41,    34,   113,
+     114,   111,   112,     0,     0,   115,   163,   133,   134,   130,
+     131,   132,   129,   144,   145,   141,   142,   143,   140,   120,
+     110,   162,   170,    97,    95,     0,     0,    92,   149,   150,
+     108,   188,     0,   109,   105,    13,    10,    16,    11,    39,
+       0,    57,     0,     0,     0,    89,     0,     0,     0,    78,
+      79,     0,   100,     0,    89,    38,    51,     0,    60,    44,
+      65,    37,   184,    89,     0,    20,   139,    89,    98,     0,
+     138,     0,   100,    62,     0,     0,     0,     0,    66,    52,
+      53,    54,     0,   101,    55,   182,    59,     0,     0,    89,
+     185,    42,   116,    32,    99,    96,     0,     0,   165,     0,
+       0,     0,     0,   174,    67,     0,    56,     0,    82,    80,
+      43,    25,    89,    58,    63,     0,   167,   169,    64,    89,
+      89,     0,     0,    89,     0,    83,    61,     0,   166,   168,
+       0,     0,     0,     0,     0,    81,     0,    85,    68,    46,
+       0,    89,     0,    89,    84,    89,     0,    89,     0,    89,
+      66,     0,    70,     0,     0,    69,     0,    47,    48,    66,
+       0,    86,    73,    76,     0,     0,    77,     0,   187,    89,
+      45,     0,    89,    75,    74,    89,    37,    89,     0,    37,
+       0,     0,    50,     0,    49
+};
+
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
@@ -952,10 +1075,21 @@ static const yytype_int16 yypgoto[] =
      -46,  -273,   -25,   -57,    85
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     1,    28,   140,   143,    29,    77,    53,    54,    30,
+      31,    83,    32,   146,    78,   205,   206,   222,   207,   237,
+     248,   255,   296,   305,   317,   208,   258,   276,   286,   209,
+     144,   145,   125,   175,   176,   232,   116,   117,   210,   115,
+      94,    95,    35,    36,    37,    38,    39,    40,    55,   264,
+     265,   266,    45,    46,    47,    41,    42,   131,   211,   212,
+     137,   239,   213,   319,   136
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
    number is the opposite.  If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -104
 static const yytype_int16 yytable[] =
 {
       34,    80,    80,    70,    81,   126,   127,   260,   121,   238,
@@ -1076,12 +1210,6 @@ static const yytype_int16 yytable[] =
        0,    90,   214,     0,    92,    93
 };
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-273)))
-
-#define yytable_value_is_error(Yytable_value) \
-  (!!((Yytable_value) == (-104)))
-
 static const yytype_int16 yycheck[] =
 {
        1,    29,    30,    26,    29,    59,    60,   238,    46,   211,
@@ -1202,8 +1330,8 @@ static const yytype_int16 yycheck[] =
       -1,    53,    54,    -1,    56,    57
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
        0,    76,     0,     1,     3,     4,     7,     8,    17,    18,
@@ -1242,67 +1370,89 @@ static const yytype_uint8 yystos[] =
       88,   106,    90,    88,    90
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  However,
-   YYFAIL appears to be in use.  Nevertheless, it is formally deprecated
-   in Bison 2.4.2's NEWS entry, where a plan to phase it out is
-   discussed.  */
-
-#define YYFAIL		goto yyerrlab
-#if defined YYFAIL
-  /* This is here to suppress warnings from the GCC cpp's
-     -Wunused-macros.  Normally we don't worry about that warning, but
-     some users do, and we want to make it easy for users to remove
-     YYFAIL uses, which will produce warnings from Bison 2.5.  */
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,    75,    76,    76,    76,    76,    76,    77,    77,    77,
+      77,    77,    78,    78,    78,    79,    79,    79,    80,    80,
+      80,    80,    80,    80,    80,    81,    82,    82,    82,    82,
+      83,    83,    84,    86,    85,    87,    87,    88,    88,    88,
+      89,    89,    90,    90,    90,    90,    90,    90,    90,    90,
+      90,    90,    91,    91,    91,    91,    91,    92,    91,    91,
+      94,    93,    95,    93,    93,    93,    96,    96,    97,    97,
+      97,    98,    98,    99,    99,    99,    99,    99,   100,   100,
+     101,   101,   102,   103,   102,   104,   104,   105,   105,   106,
+     106,   107,   107,   108,   108,   109,   109,   109,   109,   109,
+     110,   110,   111,   111,   112,   112,   112,   112,   112,   112,
+     113,   113,   113,   113,   113,   113,   113,   113,   114,   114,
+     114,   115,   115,   116,   116,   117,   117,   117,   118,   118,
+     118,   118,   118,   118,   118,   118,   118,   118,   118,   119,
+     119,   119,   119,   119,   119,   119,   120,   120,   120,   120,
+     120,   120,   120,   120,   120,   120,   120,   120,   120,   120,
+     121,   121,   122,   123,   123,   124,   124,   125,   125,   126,
+     127,   128,   128,   129,   130,   130,   131,   131,   132,   132,
+     132,   133,   134,   135,   136,   136,   137,   138,   139
+};
 
-#define YYRECOVERING()  (!!yyerrstatus)
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
+       4,     4,     1,     2,     1,     1,     2,     1,     0,     1,
+       4,     1,     1,     1,     1,     5,     1,     1,     1,     2,
+       1,     1,     6,     0,     3,     1,     1,     0,     2,     2,
+       1,     2,     2,     3,     1,     9,     6,     8,     8,    12,
+      11,     1,     2,     2,     2,     2,     3,     0,     4,     2,
+       0,     4,     0,     4,     4,     1,     0,     1,     0,     2,
+       2,     5,     4,     1,     2,     2,     1,     1,     1,     1,
+       1,     3,     0,     0,     3,     6,     9,     1,     2,     0,
+       1,     0,     2,     0,     1,     1,     3,     1,     2,     3,
+       0,     1,     0,     1,     1,     3,     1,     2,     3,     3,
+       3,     3,     3,     3,     3,     3,     5,     1,     1,     1,
+       2,     1,     1,     1,     1,     1,     1,     2,     1,     3,
+       3,     3,     3,     3,     3,     3,     2,     2,     5,     4,
+       3,     3,     3,     3,     3,     3,     1,     2,     3,     4,
+       4,     1,     1,     1,     2,     2,     1,     1,     2,     2,
+       1,     2,     4,     0,     1,     0,     2,     1,     2,     1,
+       3,     1,     2,     2,     1,     2,     1,     3,     1,     1,
+       0,     2,     2,     1,     0,     1,     1,     1,     2
+};
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-/* Error token number */
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (YYLEX_PARAM)
-#else
-# define YYLEX yylex ()
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -1312,80 +1462,58 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
-#else
-static void
-yy_symbol_print (yyoutput, yytype, yyvaluep)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1393,15 +1521,8 @@ yy_symbol_print (yyoutput, yytype, yyvaluep)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
-#else
-static void
-yy_stack_print (yybottom, yytop)
-    yytype_int16 *yybottom;
-    yytype_int16 *yytop;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1412,62 +1533,56 @@ yy_stack_print (yybottom, yytop)
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
-static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule)
-#else
 static void
-yy_reduce_print (yyvsp, yyrule)
-    YYSTYPE *yyvsp;
-    int yyrule;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       );
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -1483,355 +1598,77 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
 
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULL, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  YYSIZE_T yysize1;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULL;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - Assume YYFAIL is not used.  It's too flawed to consider.  See
-       <http://lists.gnu.org/archive/html/bison-patches/2009-12/msg00024.html>
-       for details.  YYERROR is fine as it does not invoke this
-       function.
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                yysize1 = yysize + yytnamerr (YY_NULL, yytname[yyx]);
-                if (! (yysize <= yysize1
-                       && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                  return 2;
-                yysize = yysize1;
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
-
-  yysize1 = yysize + yystrlen (yyformat);
-  if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-    return 2;
-  yysize = yysize1;
-
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
-
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
-
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-  switch (yytype)
-    {
-
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-
-#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END
-#endif
-#ifndef YY_INITIAL_VALUE
-# define YY_INITIAL_VALUE(Value) /* Nothing. */
-#endif
-
 /* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval YY_INITIAL_VALUE(yyval_default);
-
+YYSTYPE yylval;
 /* Number of syntax errors so far.  */
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__      || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void)
-#else
-int
-yyparse ()
-
-#endif
-#endif
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       `yyss': related to states.
-       `yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1839,102 +1676,107 @@ yyparse ()
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss_alloc, yyss);
-	YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1945,18 +1787,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1984,15 +1837,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2007,14 +1858,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -2027,29 +1878,28 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 3:
-/* Line 1778 of yacc.c  */
-#line 198 "awkgram.y"
-    {
+  case 3: /* program: program rule  */
+#line 205 "awkgram.y"
+          {
 		rule = 0;
 		yyerrok;
 	  }
+#line 1890 "awkgram.c"
     break;
 
-  case 5:
-/* Line 1778 of yacc.c  */
-#line 204 "awkgram.y"
-    {
+  case 5: /* program: program LEX_EOF  */
+#line 211 "awkgram.y"
+          {
 		next_sourcefile();
 		if (sourcefile == srcfiles)
 			process_deferred();
 	  }
+#line 1900 "awkgram.c"
     break;
 
-  case 6:
-/* Line 1778 of yacc.c  */
-#line 210 "awkgram.y"
-    {
+  case 6: /* program: program error  */
+#line 217 "awkgram.y"
+          {
 		rule = 0;
 		/*
 		 * If errors, give up, don't produce an infinite
@@ -2057,277 +1907,277 @@ yyreduce:
 		 */
   		/* yyerrok; */
 	  }
+#line 1913 "awkgram.c"
     break;
 
-  case 7:
-/* Line 1778 of yacc.c  */
-#line 222 "awkgram.y"
-    {
-		(void) append_rule((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)]));
+  case 7: /* rule: pattern action  */
+#line 229 "awkgram.y"
+          {
+		(void) append_rule(yyvsp[-1], yyvsp[0]);
 	  }
+#line 1921 "awkgram.c"
     break;
 
-  case 8:
-/* Line 1778 of yacc.c  */
-#line 226 "awkgram.y"
-    {
+  case 8: /* rule: pattern statement_term  */
+#line 233 "awkgram.y"
+          {
 		if (rule != Rule) {
 			msg(_("%s blocks must have an action part"), ruletab[rule]);
 			errcount++;
-		} else if ((yyvsp[(1) - (2)]) == NULL) {
+		} else if (yyvsp[-1] == NULL) {
 			msg(_("each rule must have a pattern or an action part"));
 			errcount++;
 		} else		/* pattern rule with non-empty pattern */
-			(void) append_rule((yyvsp[(1) - (2)]), NULL);
+			(void) append_rule(yyvsp[-1], NULL);
 	  }
+#line 1936 "awkgram.c"
     break;
 
-  case 9:
-/* Line 1778 of yacc.c  */
-#line 237 "awkgram.y"
-    {
+  case 9: /* rule: function_prologue action  */
+#line 244 "awkgram.y"
+          {
 		in_function = NULL;
-		(void) mk_function((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)]));
+		(void) mk_function(yyvsp[-1], yyvsp[0]);
 		yyerrok;
 	  }
+#line 1946 "awkgram.c"
     break;
 
-  case 10:
-/* Line 1778 of yacc.c  */
-#line 243 "awkgram.y"
-    {
+  case 10: /* rule: '@' LEX_INCLUDE source statement_term  */
+#line 250 "awkgram.y"
+          {
 		want_source = false;
 		yyerrok;
 	  }
+#line 1955 "awkgram.c"
     break;
 
-  case 11:
-/* Line 1778 of yacc.c  */
-#line 248 "awkgram.y"
-    {
+  case 11: /* rule: '@' LEX_LOAD library statement_term  */
+#line 255 "awkgram.y"
+          {
 		want_source = false;
 		yyerrok;
 	  }
+#line 1964 "awkgram.c"
     break;
 
-  case 12:
-/* Line 1778 of yacc.c  */
-#line 256 "awkgram.y"
-    {
-		if (include_source((yyvsp[(1) - (1)])) < 0)
+  case 12: /* source: FILENAME  */
+#line 263 "awkgram.y"
+          {
+		if (include_source(yyvsp[0]) < 0)
 			YYABORT;
-		efree((yyvsp[(1) - (1)])->lextok);
-		bcfree((yyvsp[(1) - (1)]));
-		(yyval) = NULL;
+		efree(yyvsp[0]->lextok);
+		bcfree(yyvsp[0]);
+		yyval = NULL;
 	  }
+#line 1976 "awkgram.c"
     break;
 
-  case 13:
-/* Line 1778 of yacc.c  */
-#line 264 "awkgram.y"
-    { (yyval) = NULL; }
+  case 13: /* source: FILENAME error  */
+#line 271 "awkgram.y"
+          { yyval = NULL; }
+#line 1982 "awkgram.c"
     break;
 
-  case 14:
-/* Line 1778 of yacc.c  */
-#line 266 "awkgram.y"
-    { (yyval) = NULL; }
+  case 14: /* source: error  */
+#line 273 "awkgram.y"
+          { yyval = NULL; }
+#line 1988 "awkgram.c"
     break;
 
-  case 15:
-/* Line 1778 of yacc.c  */
-#line 271 "awkgram.y"
-    {
-		if (load_library((yyvsp[(1) - (1)])) < 0)
+  case 15: /* library: FILENAME  */
+#line 278 "awkgram.y"
+          {
+		if (load_library(yyvsp[0]) < 0)
 			YYABORT;
-		efree((yyvsp[(1) - (1)])->lextok);
-		bcfree((yyvsp[(1) - (1)]));
-		(yyval) = NULL;
+		efree(yyvsp[0]->lextok);
+		bcfree(yyvsp[0]);
+		yyval = NULL;
 	  }
+#line 2000 "awkgram.c"
     break;
 
-  case 16:
-/* Line 1778 of yacc.c  */
-#line 279 "awkgram.y"
-    { (yyval) = NULL; }
+  case 16: /* library: FILENAME error  */
+#line 286 "awkgram.y"
+          { yyval = NULL; }
+#line 2006 "awkgram.c"
     break;
 
-  case 17:
-/* Line 1778 of yacc.c  */
-#line 281 "awkgram.y"
-    { (yyval) = NULL; }
+  case 17: /* library: error  */
+#line 288 "awkgram.y"
+          { yyval = NULL; }
+#line 2012 "awkgram.c"
     break;
 
-  case 18:
-/* Line 1778 of yacc.c  */
-#line 286 "awkgram.y"
-    {	(yyval) = NULL; rule = Rule; }
+  case 18: /* pattern: %empty  */
+#line 293 "awkgram.y"
+          {	yyval = NULL; rule = Rule; }
+#line 2018 "awkgram.c"
     break;
 
-  case 19:
-/* Line 1778 of yacc.c  */
-#line 288 "awkgram.y"
-    {	(yyval) = (yyvsp[(1) - (1)]); rule = Rule; }
+  case 19: /* pattern: exp  */
+#line 295 "awkgram.y"
+          {	yyval = yyvsp[0]; rule = Rule; }
+#line 2024 "awkgram.c"
     break;
 
-  case 20:
-/* Line 1778 of yacc.c  */
-#line 290 "awkgram.y"
-    {
+  case 20: /* pattern: exp ',' opt_nls exp  */
+#line 297 "awkgram.y"
+          {
 		INSTRUCTION *tp;
 
-		add_lint((yyvsp[(1) - (4)]), LINT_assign_in_cond);
-		add_lint((yyvsp[(4) - (4)]), LINT_assign_in_cond);
+		add_lint(yyvsp[-3], LINT_assign_in_cond);
+		add_lint(yyvsp[0], LINT_assign_in_cond);
 
 		tp = instruction(Op_no_op);
-		list_prepend((yyvsp[(1) - (4)]), bcalloc(Op_line_range, !!do_pretty_print + 1, 0));
-		(yyvsp[(1) - (4)])->nexti->triggered = false;
-		(yyvsp[(1) - (4)])->nexti->target_jmp = (yyvsp[(4) - (4)])->nexti;
+		list_prepend(yyvsp[-3], bcalloc(Op_line_range, !!do_pretty_print + 1, 0));
+		yyvsp[-3]->nexti->triggered = false;
+		yyvsp[-3]->nexti->target_jmp = yyvsp[0]->nexti;
 
-		list_append((yyvsp[(1) - (4)]), instruction(Op_cond_pair));
-		(yyvsp[(1) - (4)])->lasti->line_range = (yyvsp[(1) - (4)])->nexti;
-		(yyvsp[(1) - (4)])->lasti->target_jmp = tp;
+		list_append(yyvsp[-3], instruction(Op_cond_pair));
+		yyvsp[-3]->lasti->line_range = yyvsp[-3]->nexti;
+		yyvsp[-3]->lasti->target_jmp = tp;
 
-		list_append((yyvsp[(4) - (4)]), instruction(Op_cond_pair));
-		(yyvsp[(4) - (4)])->lasti->line_range = (yyvsp[(1) - (4)])->nexti;
-		(yyvsp[(4) - (4)])->lasti->target_jmp = tp;
+		list_append(yyvsp[0], instruction(Op_cond_pair));
+		yyvsp[0]->lasti->line_range = yyvsp[-3]->nexti;
+		yyvsp[0]->lasti->target_jmp = tp;
 		if (do_pretty_print) {
-			((yyvsp[(1) - (4)])->nexti + 1)->condpair_left = (yyvsp[(1) - (4)])->lasti;
-			((yyvsp[(1) - (4)])->nexti + 1)->condpair_right = (yyvsp[(4) - (4)])->lasti;
+			(yyvsp[-3]->nexti + 1)->condpair_left = yyvsp[-3]->lasti;
+			(yyvsp[-3]->nexti + 1)->condpair_right = yyvsp[0]->lasti;
 		}
-		(yyval) = list_append(list_merge((yyvsp[(1) - (4)]), (yyvsp[(4) - (4)])), tp);
+		yyval = list_append(list_merge(yyvsp[-3], yyvsp[0]), tp);
 		rule = Rule;
 	  }
+#line 2054 "awkgram.c"
     break;
 
-  case 21:
-/* Line 1778 of yacc.c  */
-#line 316 "awkgram.y"
-    {
+  case 21: /* pattern: LEX_BEGIN  */
+#line 323 "awkgram.y"
+          {
 		static int begin_seen = 0;
 		if (do_lint_old && ++begin_seen == 2)
-			warning_ln((yyvsp[(1) - (1)])->source_line,
+			warning_ln(yyvsp[0]->source_line,
 				_("old awk does not support multiple `BEGIN' or `END' rules"));
 
-		(yyvsp[(1) - (1)])->in_rule = rule = BEGIN;
-		(yyvsp[(1) - (1)])->source_file = source;
-		(yyval) = (yyvsp[(1) - (1)]);
+		yyvsp[0]->in_rule = rule = BEGIN;
+		yyvsp[0]->source_file = source;
+		yyval = yyvsp[0];
 	  }
+#line 2069 "awkgram.c"
     break;
 
-  case 22:
-/* Line 1778 of yacc.c  */
-#line 327 "awkgram.y"
-    {
+  case 22: /* pattern: LEX_END  */
+#line 334 "awkgram.y"
+          {
 		static int end_seen = 0;
 		if (do_lint_old && ++end_seen == 2)
-			warning_ln((yyvsp[(1) - (1)])->source_line,
+			warning_ln(yyvsp[0]->source_line,
 				_("old awk does not support multiple `BEGIN' or `END' rules"));
 
-		(yyvsp[(1) - (1)])->in_rule = rule = END;
-		(yyvsp[(1) - (1)])->source_file = source;
-		(yyval) = (yyvsp[(1) - (1)]);
+		yyvsp[0]->in_rule = rule = END;
+		yyvsp[0]->source_file = source;
+		yyval = yyvsp[0];
 	  }
+#line 2084 "awkgram.c"
     break;
 
-  case 23:
-/* Line 1778 of yacc.c  */
-#line 338 "awkgram.y"
-    {
-		(yyvsp[(1) - (1)])->in_rule = rule = BEGINFILE;
-		(yyvsp[(1) - (1)])->source_file = source;
-		(yyval) = (yyvsp[(1) - (1)]);
+  case 23: /* pattern: LEX_BEGINFILE  */
+#line 345 "awkgram.y"
+          {
+		yyvsp[0]->in_rule = rule = BEGINFILE;
+		yyvsp[0]->source_file = source;
+		yyval = yyvsp[0];
 	  }
+#line 2094 "awkgram.c"
     break;
 
-  case 24:
-/* Line 1778 of yacc.c  */
-#line 344 "awkgram.y"
-    {
-		(yyvsp[(1) - (1)])->in_rule = rule = ENDFILE;
-		(yyvsp[(1) - (1)])->source_file = source;
-		(yyval) = (yyvsp[(1) - (1)]);
+  case 24: /* pattern: LEX_ENDFILE  */
+#line 351 "awkgram.y"
+          {
+		yyvsp[0]->in_rule = rule = ENDFILE;
+		yyvsp[0]->source_file = source;
+		yyval = yyvsp[0];
 	  }
+#line 2104 "awkgram.c"
     break;
 
-  case 25:
-/* Line 1778 of yacc.c  */
-#line 353 "awkgram.y"
-    {
-		if ((yyvsp[(2) - (5)]) == NULL)
-			(yyval) = list_create(instruction(Op_no_op));
+  case 25: /* action: l_brace statements r_brace opt_semi opt_nls  */
+#line 360 "awkgram.y"
+          {
+		if (yyvsp[-3] == NULL)
+			yyval = list_create(instruction(Op_no_op));
 		else
-			(yyval) = (yyvsp[(2) - (5)]);
+			yyval = yyvsp[-3];
 	  }
+#line 2115 "awkgram.c"
     break;
 
-  case 26:
-/* Line 1778 of yacc.c  */
-#line 363 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 26: /* func_name: NAME  */
+#line 370 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 2121 "awkgram.c"
     break;
 
-  case 27:
-/* Line 1778 of yacc.c  */
-#line 365 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 27: /* func_name: FUNC_CALL  */
+#line 372 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 2127 "awkgram.c"
     break;
 
-  case 28:
-/* Line 1778 of yacc.c  */
-#line 367 "awkgram.y"
-    {
+  case 28: /* func_name: lex_builtin  */
+#line 374 "awkgram.y"
+          {
 		yyerror(_("`%s' is a built-in function, it cannot be redefined"),
 					tokstart);
 		YYABORT;
 	  }
+#line 2137 "awkgram.c"
     break;
 
-  case 29:
-/* Line 1778 of yacc.c  */
-#line 373 "awkgram.y"
-    { (yyval) = (yyvsp[(2) - (2)]); }
+  case 29: /* func_name: '@' LEX_EVAL  */
+#line 380 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 2143 "awkgram.c"
     break;
 
-  case 32:
-/* Line 1778 of yacc.c  */
-#line 383 "awkgram.y"
-    {
-		(yyvsp[(1) - (6)])->source_file = source;
-		if (install_function((yyvsp[(2) - (6)])->lextok, (yyvsp[(1) - (6)]), (yyvsp[(4) - (6)])) < 0)
+  case 32: /* function_prologue: LEX_FUNCTION func_name '(' opt_param_list r_paren opt_nls  */
+#line 390 "awkgram.y"
+          {
+		yyvsp[-5]->source_file = source;
+		if (install_function(yyvsp[-4]->lextok, yyvsp[-5], yyvsp[-2]) < 0)
 			YYABORT;
-		in_function = (yyvsp[(2) - (6)])->lextok;
-		(yyvsp[(2) - (6)])->lextok = NULL;
-		bcfree((yyvsp[(2) - (6)]));
+		in_function = yyvsp[-4]->lextok;
+		yyvsp[-4]->lextok = NULL;
+		bcfree(yyvsp[-4]);
 		/* $4 already free'd in install_function */
-		(yyval) = (yyvsp[(1) - (6)]);
+		yyval = yyvsp[-5];
 	  }
+#line 2158 "awkgram.c"
     break;
 
-  case 33:
-/* Line 1778 of yacc.c  */
-#line 401 "awkgram.y"
-    { want_regexp = true; }
+  case 33: /* $@1: %empty  */
+#line 408 "awkgram.y"
+                { want_regexp = true; }
+#line 2164 "awkgram.c"
     break;
 
-  case 34:
-/* Line 1778 of yacc.c  */
-#line 403 "awkgram.y"
-    {
+  case 34: /* regexp: a_slash $@1 REGEXP  */
+#line 410 "awkgram.y"
+                {
 		  NODE *n, *exp;
 		  char *re;
 		  size_t len;
 
-		  re = (yyvsp[(3) - (3)])->lextok;
-		  (yyvsp[(3) - (3)])->lextok = NULL;
+		  re = yyvsp[0]->lextok;
+		  yyvsp[0]->lextok = NULL;
 		  len = strlen(re);
 		  if (do_lint) {
 			if (len == 0)
-				lintwarn_ln((yyvsp[(3) - (3)])->source_line,
+				lintwarn_ln(yyvsp[0]->source_line,
 					_("regexp constant `//' looks like a C++ comment, but is not"));
 			else if (re[0] == '*' && re[len-1] == '*')
 				/* possible C comment */
-				lintwarn_ln((yyvsp[(3) - (3)])->source_line,
+				lintwarn_ln(yyvsp[0]->source_line,
 					_("regexp constant `/%s/' looks like a C comment, but is not"), re);
 		  }
 
@@ -2337,74 +2187,79 @@ yyreduce:
 			unref(exp);
 			YYABORT;
 		  }
-		  (yyval) = (yyvsp[(3) - (3)]);
-		  (yyval)->opcode = Op_match_rec;
-		  (yyval)->memory = n;
+		  yyval = yyvsp[0];
+		  yyval->opcode = Op_match_rec;
+		  yyval->memory = n;
 		}
+#line 2197 "awkgram.c"
     break;
 
-  case 35:
-/* Line 1778 of yacc.c  */
-#line 435 "awkgram.y"
-    { bcfree((yyvsp[(1) - (1)])); }
+  case 35: /* a_slash: '/'  */
+#line 442 "awkgram.y"
+          { bcfree(yyvsp[0]); }
+#line 2203 "awkgram.c"
     break;
 
-  case 37:
-/* Line 1778 of yacc.c  */
-#line 441 "awkgram.y"
-    {	(yyval) = NULL; }
+  case 37: /* statements: %empty  */
+#line 448 "awkgram.y"
+          {	yyval = NULL; }
+#line 2209 "awkgram.c"
     break;
 
-  case 38:
-/* Line 1778 of yacc.c  */
-#line 443 "awkgram.y"
-    {
-		if ((yyvsp[(2) - (2)]) == NULL)
-			(yyval) = (yyvsp[(1) - (2)]);
+  case 38: /* statements: statements statement  */
+#line 450 "awkgram.y"
+          {
+		if (yyvsp[0] == NULL)
+			yyval = yyvsp[-1];
 		else {
-			add_lint((yyvsp[(2) - (2)]), LINT_no_effect);
-			if ((yyvsp[(1) - (2)]) == NULL)
-				(yyval) = (yyvsp[(2) - (2)]);
+			add_lint(yyvsp[0], LINT_no_effect);
+			if (yyvsp[-1] == NULL)
+				yyval = yyvsp[0];
+			else if (ends_flow(yyvsp[-1])) {
+				/* $2 can never be reached; drop it */
+				free_bc_list(yyvsp[0]);
+				yyval = yyvsp[-1];
+			}
 			else
-				(yyval) = list_merge((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)]));
+				yyval = list_merge(yyvsp[-1], yyvsp[0]);
 		}
 	    yyerrok;
 	  }
+#line 2231 "awkgram.c"
     break;
 
-  case 39:
-/* Line 1778 of yacc.c  */
-#line 456 "awkgram.y"
-    {	(yyval) = NULL; }
+  case 39: /* statements: statements error  */
+#line 468 "awkgram.y"
+          {	yyval = NULL; }
+#line 2237 "awkgram.c"
     break;
 
-  case 42:
-/* Line 1778 of yacc.c  */
-#line 466 "awkgram.y"
-    { (yyval) = NULL; }
+  case 42: /* statement: semi opt_nls  */
+#line 478 "awkgram.y"
+          { yyval = NULL; }
+#line 2243 "awkgram.c"
     break;
 
-  case 43:
-/* Line 1778 of yacc.c  */
-#line 468 "awkgram.y"
-    { (yyval) = (yyvsp[(2) - (3)]); }
+  case 43: /* statement: l_brace statements r_brace  */
+#line 480 "awkgram.y"
+          { yyval = yyvsp[-1]; }
+#line 2249 "awkgram.c"
     break;
 
-  case 44:
-/* Line 1778 of yacc.c  */
-#line 470 "awkgram.y"
-    {
+  case 44: /* statement: if_statement  */
+#line 482 "awkgram.y"
+          {
 		if (do_pretty_print)
-			(yyval) = list_prepend((yyvsp[(1) - (1)]), instruction(Op_exec_count));
+			yyval = list_prepend(yyvsp[0], instruction(Op_exec_count));
 		else
-			(yyval) = (yyvsp[(1) - (1)]);
+			yyval = yyvsp[0];
  	  }
+#line 2260 "awkgram.c"
     break;
 
-  case 45:
-/* Line 1778 of yacc.c  */
-#line 477 "awkgram.y"
-    {
+  case 45: /* statement: LEX_SWITCH '(' exp r_paren opt_nls l_brace case_statements opt_nls r_brace  */
+#line 489 "awkgram.y"
+          {
 		INSTRUCTION *dflt, *curr = NULL, *cexp, *cstmt;
 		INSTRUCTION *ip, *nextc, *tbreak;
 		const char **case_values = NULL;
@@ -2418,9 +2273,9 @@ yyreduce:
 		dflt = instruction(Op_jmp);
 		dflt->target_jmp = tbreak;	/* if no case match and no explicit default */
 
-		if ((yyvsp[(7) - (9)]) != NULL) {
-			curr = (yyvsp[(7) - (9)])->nexti;
-			bcfree((yyvsp[(7) - (9)]));	/* Op_list */
+		if (yyvsp[-2] != NULL) {
+			curr = yyvsp[-2]->nexti;
+			bcfree(yyvsp[-2]);	/* Op_list */
 		} /*  else
 				curr = NULL; */
 
@@ -2476,29 +2331,29 @@ yyreduce:
 		if (case_values != NULL)
 			efree(case_values);
 
-		ip = (yyvsp[(3) - (9)]);
+		ip = yyvsp[-6];
 		if (do_pretty_print) {
-			(void) list_prepend(ip, (yyvsp[(1) - (9)]));
+			(void) list_prepend(ip, yyvsp[-8]);
 			(void) list_prepend(ip, instruction(Op_exec_count));
-			(yyvsp[(1) - (9)])->target_break = tbreak;
-			((yyvsp[(1) - (9)]) + 1)->switch_start = cexp->nexti;
-			((yyvsp[(1) - (9)]) + 1)->switch_end = cexp->lasti;
+			yyvsp[-8]->target_break = tbreak;
+			(yyvsp[-8] + 1)->switch_start = cexp->nexti;
+			(yyvsp[-8] + 1)->switch_end = cexp->lasti;
 		}/* else
 				$1 is NULL */
 
 		(void) list_append(cexp, dflt);
 		(void) list_merge(ip, cexp);
-		(yyval) = list_merge(ip, cstmt);
+		yyval = list_merge(ip, cstmt);
 
 		break_allowed--;			
 		fix_break_continue(ip, tbreak, NULL);
 	  }
+#line 2354 "awkgram.c"
     break;
 
-  case 46:
-/* Line 1778 of yacc.c  */
-#line 567 "awkgram.y"
-    { 
+  case 46: /* statement: LEX_WHILE '(' exp r_paren opt_nls statement  */
+#line 579 "awkgram.y"
+          { 
 		/*
 		 *    -----------------
 		 * tc:
@@ -2515,36 +2370,36 @@ yyreduce:
 		INSTRUCTION *ip, *tbreak, *tcont;
 
 		tbreak = instruction(Op_no_op);
-		add_lint((yyvsp[(3) - (6)]), LINT_assign_in_cond);
-		tcont = (yyvsp[(3) - (6)])->nexti;
-		ip = list_append((yyvsp[(3) - (6)]), instruction(Op_jmp_false));
+		add_lint(yyvsp[-3], LINT_assign_in_cond);
+		tcont = yyvsp[-3]->nexti;
+		ip = list_append(yyvsp[-3], instruction(Op_jmp_false));
 		ip->lasti->target_jmp = tbreak;
 
 		if (do_pretty_print) {
 			(void) list_append(ip, instruction(Op_exec_count));
-			(yyvsp[(1) - (6)])->target_break = tbreak;
-			(yyvsp[(1) - (6)])->target_continue = tcont;
-			((yyvsp[(1) - (6)]) + 1)->while_body = ip->lasti;
-			(void) list_prepend(ip, (yyvsp[(1) - (6)]));
+			yyvsp[-5]->target_break = tbreak;
+			yyvsp[-5]->target_continue = tcont;
+			(yyvsp[-5] + 1)->while_body = ip->lasti;
+			(void) list_prepend(ip, yyvsp[-5]);
 		}/* else
 				$1 is NULL */
 
-		if ((yyvsp[(6) - (6)]) != NULL)
-			(void) list_merge(ip, (yyvsp[(6) - (6)]));
+		if (yyvsp[0] != NULL)
+			(void) list_merge(ip, yyvsp[0]);
 		(void) list_append(ip, instruction(Op_jmp));
 		ip->lasti->target_jmp = tcont;
-		(yyval) = list_append(ip, tbreak);
+		yyval = list_append(ip, tbreak);
 
 		break_allowed--;
 		continue_allowed--;
 		fix_break_continue(ip, tbreak, tcont);
 	  }
+#line 2400 "awkgram.c"
     break;
 
-  case 47:
-/* Line 1778 of yacc.c  */
-#line 609 "awkgram.y"
-    {
+  case 47: /* statement: LEX_DO opt_nls statement LEX_WHILE '(' exp r_paren opt_nls  */
+#line 621 "awkgram.y"
+          {
 		/*
 		 *    -----------------
 		 * z:
@@ -2560,46 +2415,46 @@ yyreduce:
 		INSTRUCTION *ip, *tbreak, *tcont;
 
 		tbreak = instruction(Op_no_op);
-		tcont = (yyvsp[(6) - (8)])->nexti;
-		add_lint((yyvsp[(6) - (8)]), LINT_assign_in_cond);
-		if ((yyvsp[(3) - (8)]) != NULL)
-			ip = list_merge((yyvsp[(3) - (8)]), (yyvsp[(6) - (8)]));
+		tcont = yyvsp[-2]->nexti;
+		add_lint(yyvsp[-2], LINT_assign_in_cond);
+		if (yyvsp[-5] != NULL)
+			ip = list_merge(yyvsp[-5], yyvsp[-2]);
 		else
-			ip = list_prepend((yyvsp[(6) - (8)]), instruction(Op_no_op));
+			ip = list_prepend(yyvsp[-2], instruction(Op_no_op));
 		if (do_pretty_print)
 			(void) list_prepend(ip, instruction(Op_exec_count));
 		(void) list_append(ip, instruction(Op_jmp_true));
 		ip->lasti->target_jmp = ip->nexti;
-		(yyval) = list_append(ip, tbreak);
+		yyval = list_append(ip, tbreak);
 
 		break_allowed--;
 		continue_allowed--;
 		fix_break_continue(ip, tbreak, tcont);
 
 		if (do_pretty_print) {
-			(yyvsp[(1) - (8)])->target_break = tbreak;
-			(yyvsp[(1) - (8)])->target_continue = tcont;
-			((yyvsp[(1) - (8)]) + 1)->doloop_cond = tcont;
-			(yyval) = list_prepend(ip, (yyvsp[(1) - (8)]));
-			bcfree((yyvsp[(4) - (8)]));
+			yyvsp[-7]->target_break = tbreak;
+			yyvsp[-7]->target_continue = tcont;
+			(yyvsp[-7] + 1)->doloop_cond = tcont;
+			yyval = list_prepend(ip, yyvsp[-7]);
+			bcfree(yyvsp[-4]);
 		} /* else
 				$1 and $4 are NULLs */
 	  }
+#line 2446 "awkgram.c"
     break;
 
-  case 48:
-/* Line 1778 of yacc.c  */
-#line 651 "awkgram.y"
-    {
+  case 48: /* statement: LEX_FOR '(' NAME LEX_IN simple_variable r_paren opt_nls statement  */
+#line 663 "awkgram.y"
+          {
 		INSTRUCTION *ip;
-		char *var_name = (yyvsp[(3) - (8)])->lextok;
-
-		if ((yyvsp[(8) - (8)]) != NULL
-				&& (yyvsp[(8) - (8)])->lasti->opcode == Op_K_delete
-				&& (yyvsp[(8) - (8)])->lasti->expr_count == 1
-				&& (yyvsp[(8) - (8)])->nexti->opcode == Op_push
-				&& ((yyvsp[(8) - (8)])->nexti->memory->type != Node_var || !((yyvsp[(8) - (8)])->nexti->memory->var_update))
-				&& strcmp((yyvsp[(8) - (8)])->nexti->memory->vname, var_name) == 0
+		char *var_name = yyvsp[-5]->lextok;
+
+		if (yyvsp[0] != NULL
+				&& yyvsp[0]->lasti->opcode == Op_K_delete
+				&& yyvsp[0]->lasti->expr_count == 1
+				&& yyvsp[0]->nexti->opcode == Op_push
+				&& (yyvsp[0]->nexti->memory->type != Node_var || !(yyvsp[0]->nexti->memory->var_update))
+				&& strcmp(yyvsp[0]->nexti->memory->vname, var_name) == 0
 		) {
 		
 		/* Efficiency hack.  Recognize the special case of
@@ -2616,25 +2471,25 @@ yyreduce:
 		 */		 
 			NODE *arr = NULL;
 
-			ip = (yyvsp[(8) - (8)])->nexti->nexti; 
-			if ((yyvsp[(5) - (8)])->nexti->opcode == Op_push && (yyvsp[(5) - (8)])->lasti == (yyvsp[(5) - (8)])->nexti)
-				arr = (yyvsp[(5) - (8)])->nexti->memory;
+			ip = yyvsp[0]->nexti->nexti; 
+			if (yyvsp[-3]->nexti->opcode == Op_push && yyvsp[-3]->lasti == yyvsp[-3]->nexti)
+				arr = yyvsp[-3]->nexti->memory;
 			if (arr != NULL
 					&& ip->opcode == Op_no_op
 					&& ip->nexti->opcode == Op_push_array
 					&& strcmp(ip->nexti->memory->vname, arr->vname) == 0
-					&& ip->nexti->nexti == (yyvsp[(8) - (8)])->lasti
+					&& ip->nexti->nexti == yyvsp[0]->lasti
 			) {
-				(void) make_assignable((yyvsp[(8) - (8)])->nexti);
-				(yyvsp[(8) - (8)])->lasti->opcode = Op_K_delete_loop;
-				(yyvsp[(8) - (8)])->lasti->expr_count = 0;
-				if ((yyvsp[(1) - (8)]) != NULL)
-					bcfree((yyvsp[(1) - (8)]));
+				(void) make_assignable(yyvsp[0]->nexti);
+				yyvsp[0]->lasti->opcode = Op_K_delete_loop;
+				yyvsp[0]->lasti->expr_count = 0;
+				if (yyvsp[-7] != NULL)
+					bcfree(yyvsp[-7]);
 				efree(var_name);
-				bcfree((yyvsp[(3) - (8)]));
-				bcfree((yyvsp[(4) - (8)]));
-				bcfree((yyvsp[(5) - (8)]));
-				(yyval) = (yyvsp[(8) - (8)]);
+				bcfree(yyvsp[-5]);
+				bcfree(yyvsp[-4]);
+				bcfree(yyvsp[-3]);
+				yyval = yyvsp[0];
 			} else
 				goto regular_loop;
 		} else {
@@ -2651,221 +2506,221 @@ yyreduce:
 			 * ib:[Op_arrayfor_final      ]
 			 */
 regular_loop:
-			ip = (yyvsp[(5) - (8)]);
+			ip = yyvsp[-3];
 			ip->nexti->opcode = Op_push_array;
 
 			tbreak = instruction(Op_arrayfor_final);
-			(yyvsp[(4) - (8)])->opcode = Op_arrayfor_incr;
-			(yyvsp[(4) - (8)])->array_var = variable((yyvsp[(3) - (8)])->source_line, var_name, Node_var);
-			(yyvsp[(4) - (8)])->target_jmp = tbreak;
-			tcont = (yyvsp[(4) - (8)]);
-			(yyvsp[(3) - (8)])->opcode = Op_arrayfor_init;
-			(yyvsp[(3) - (8)])->target_jmp = tbreak;
-			(void) list_append(ip, (yyvsp[(3) - (8)]));
+			yyvsp[-4]->opcode = Op_arrayfor_incr;
+			yyvsp[-4]->array_var = variable(yyvsp[-5]->source_line, var_name, Node_var);
+			yyvsp[-4]->target_jmp = tbreak;
+			tcont = yyvsp[-4];
+			yyvsp[-5]->opcode = Op_arrayfor_init;
+			yyvsp[-5]->target_jmp = tbreak;
+			(void) list_append(ip, yyvsp[-5]);
 
 			if (do_pretty_print) {
-				(yyvsp[(1) - (8)])->opcode = Op_K_arrayfor;
-				(yyvsp[(1) - (8)])->target_continue = tcont;
-				(yyvsp[(1) - (8)])->target_break = tbreak;
-				(void) list_append(ip, (yyvsp[(1) - (8)]));
+				yyvsp[-7]->opcode = Op_K_arrayfor;
+				yyvsp[-7]->target_continue = tcont;
+				yyvsp[-7]->target_break = tbreak;
+				(void) list_append(ip, yyvsp[-7]);
 			} /* else
 					$1 is NULL */
 
 			/* add update_FOO instruction if necessary */ 
-			if ((yyvsp[(4) - (8)])->array_var->type == Node_var && (yyvsp[(4) - (8)])->array_var->var_update) {
+			if (yyvsp[-4]->array_var->type == Node_var && yyvsp[-4]->array_var->var_update) {
 				(void) list_append(ip, instruction(Op_var_update));
-				ip->lasti->update_var = (yyvsp[(4) - (8)])->array_var->var_update;
+				ip->lasti->update_var = yyvsp[-4]->array_var->var_update;
 			}
-			(void) list_append(ip, (yyvsp[(4) - (8)]));
+			(void) list_append(ip, yyvsp[-4]);
 
 			/* add set_FOO instruction if necessary */
-			if ((yyvsp[(4) - (8)])->array_var->type == Node_var && (yyvsp[(4) - (8)])->array_var->var_assign) {
+			if (yyvsp[-4]->array_var->type == Node_var && yyvsp[-4]->array_var->var_assign) {
 				(void) list_append(ip, instruction(Op_var_assign));
-				ip->lasti->assign_var = (yyvsp[(4) - (8)])->array_var->var_assign;
+				ip->lasti->assign_var = yyvsp[-4]->array_var->var_assign;
 			}
 
 			if (do_pretty_print) {
 				(void) list_append(ip, instruction(Op_exec_count));
-				((yyvsp[(1) - (8)]) + 1)->forloop_cond = (yyvsp[(4) - (8)]);
-				((yyvsp[(1) - (8)]) + 1)->forloop_body = ip->lasti; 
+				(yyvsp[-7] + 1)->forloop_cond = yyvsp[-4];
+				(yyvsp[-7] + 1)->forloop_body = ip->lasti; 
 			}
 
-			if ((yyvsp[(8) - (8)]) != NULL)
-				(void) list_merge(ip, (yyvsp[(8) - (8)]));
+			if (yyvsp[0] != NULL)
+				(void) list_merge(ip, yyvsp[0]);
 
 			(void) list_append(ip, instruction(Op_jmp));
-			ip->lasti->target_jmp = (yyvsp[(4) - (8)]);
-			(yyval) = list_append(ip, tbreak);
+			ip->lasti->target_jmp = yyvsp[-4];
+			yyval = list_append(ip, tbreak);
 			fix_break_continue(ip, tbreak, tcont);
 		} 
 
 		break_allowed--;
 		continue_allowed--;
 	  }
+#line 2563 "awkgram.c"
     break;
 
-  case 49:
-/* Line 1778 of yacc.c  */
-#line 764 "awkgram.y"
-    {
-		(yyval) = mk_for_loop((yyvsp[(1) - (12)]), (yyvsp[(3) - (12)]), (yyvsp[(6) - (12)]), (yyvsp[(9) - (12)]), (yyvsp[(12) - (12)]));
+  case 49: /* statement: LEX_FOR '(' opt_simple_stmt semi opt_nls exp semi opt_nls opt_simple_stmt r_paren opt_nls statement  */
+#line 776 "awkgram.y"
+          {
+		yyval = mk_for_loop(yyvsp[-11], yyvsp[-9], yyvsp[-6], yyvsp[-3], yyvsp[0]);
 
 		break_allowed--;
 		continue_allowed--;
 	  }
+#line 2574 "awkgram.c"
     break;
 
-  case 50:
-/* Line 1778 of yacc.c  */
-#line 771 "awkgram.y"
-    {
-		(yyval) = mk_for_loop((yyvsp[(1) - (11)]), (yyvsp[(3) - (11)]), (INSTRUCTION *) NULL, (yyvsp[(8) - (11)]), (yyvsp[(11) - (11)]));
+  case 50: /* statement: LEX_FOR '(' opt_simple_stmt semi opt_nls semi opt_nls opt_simple_stmt r_paren opt_nls statement  */
+#line 783 "awkgram.y"
+          {
+		yyval = mk_for_loop(yyvsp[-10], yyvsp[-8], (INSTRUCTION *) NULL, yyvsp[-3], yyvsp[0]);
 
 		break_allowed--;
 		continue_allowed--;
 	  }
+#line 2585 "awkgram.c"
     break;
 
-  case 51:
-/* Line 1778 of yacc.c  */
-#line 778 "awkgram.y"
-    {
+  case 51: /* statement: non_compound_stmt  */
+#line 790 "awkgram.y"
+          {
 		if (do_pretty_print)
-			(yyval) = list_prepend((yyvsp[(1) - (1)]), instruction(Op_exec_count));
+			yyval = list_prepend(yyvsp[0], instruction(Op_exec_count));
 		else
-			(yyval) = (yyvsp[(1) - (1)]);
+			yyval = yyvsp[0];
 	  }
+#line 2596 "awkgram.c"
     break;
 
-  case 52:
-/* Line 1778 of yacc.c  */
-#line 788 "awkgram.y"
-    { 
+  case 52: /* non_compound_stmt: LEX_BREAK statement_term  */
+#line 800 "awkgram.y"
+          { 
 		if (! break_allowed)
-			error_ln((yyvsp[(1) - (2)])->source_line,
+			error_ln(yyvsp[-1]->source_line,
 				_("`break' is not allowed outside a loop or switch"));
-		(yyvsp[(1) - (2)])->target_jmp = NULL;
-		(yyval) = list_create((yyvsp[(1) - (2)]));
+		yyvsp[-1]->target_jmp = NULL;
+		yyval = list_create(yyvsp[-1]);
 
 	  }
+#line 2609 "awkgram.c"
     break;
 
-  case 53:
-/* Line 1778 of yacc.c  */
-#line 797 "awkgram.y"
-    {
+  case 53: /* non_compound_stmt: LEX_CONTINUE statement_term  */
+#line 809 "awkgram.y"
+          {
 		if (! continue_allowed)
-			error_ln((yyvsp[(1) - (2)])->source_line,
+			error_ln(yyvsp[-1]->source_line,
 				_("`continue' is not allowed outside a loop"));
-		(yyvsp[(1) - (2)])->target_jmp = NULL;
-		(yyval) = list_create((yyvsp[(1) - (2)]));
+		yyvsp[-1]->target_jmp = NULL;
+		yyval = list_create(yyvsp[-1]);
 
 	  }
+#line 2622 "awkgram.c"
     break;
 
-  case 54:
-/* Line 1778 of yacc.c  */
-#line 806 "awkgram.y"
-    {
+  case 54: /* non_compound_stmt: LEX_NEXT statement_term  */
+#line 818 "awkgram.y"
+          {
 		/* if inside function (rule = 0), resolve context at run-time */
 		if (rule && rule != Rule)
-			error_ln((yyvsp[(1) - (2)])->source_line,
+			error_ln(yyvsp[-1]->source_line,
 				_("`next' used in %s action"), ruletab[rule]);
-		(yyvsp[(1) - (2)])->target_jmp = ip_rec;
-		(yyval) = list_create((yyvsp[(1) - (2)]));
+		yyvsp[-1]->target_jmp = ip_rec;
+		yyval = list_create(yyvsp[-1]);
 	  }
+#line 2635 "awkgram.c"
     break;
 
-  case 55:
-/* Line 1778 of yacc.c  */
-#line 815 "awkgram.y"
-    {
+  case 55: /* non_compound_stmt: LEX_NEXTFILE statement_term  */
+#line 827 "awkgram.y"
+          {
 		/* if inside function (rule = 0), resolve context at run-time */
 		if (rule == BEGIN || rule == END || rule == ENDFILE)
-			error_ln((yyvsp[(1) - (2)])->source_line,
+			error_ln(yyvsp[-1]->source_line,
 				_("`nextfile' used in %s action"), ruletab[rule]);
 
-		(yyvsp[(1) - (2)])->target_newfile = ip_newfile;
-		(yyvsp[(1) - (2)])->target_endfile = ip_endfile;
-		(yyval) = list_create((yyvsp[(1) - (2)]));
+		yyvsp[-1]->target_newfile = ip_newfile;
+		yyvsp[-1]->target_endfile = ip_endfile;
+		yyval = list_create(yyvsp[-1]);
 	  }
+#line 2650 "awkgram.c"
     break;
 
-  case 56:
-/* Line 1778 of yacc.c  */
-#line 826 "awkgram.y"
-    {
+  case 56: /* non_compound_stmt: LEX_EXIT opt_exp statement_term  */
+#line 838 "awkgram.y"
+          {
 		/* Initialize the two possible jump targets, the actual target
 		 * is resolved at run-time. 
 		 */
-		(yyvsp[(1) - (3)])->target_end = ip_end;	/* first instruction in end_block */
-		(yyvsp[(1) - (3)])->target_atexit = ip_atexit;	/* cleanup and go home */
+		yyvsp[-2]->target_end = ip_end;	/* first instruction in end_block */
+		yyvsp[-2]->target_atexit = ip_atexit;	/* cleanup and go home */
 
-		if ((yyvsp[(2) - (3)]) == NULL) {
-			(yyval) = list_create((yyvsp[(1) - (3)]));
-			(void) list_prepend((yyval), instruction(Op_push_i));
-			(yyval)->nexti->memory = dupnode(Nnull_string);
+		if (yyvsp[-1] == NULL) {
+			yyval = list_create(yyvsp[-2]);
+			(void) list_prepend(yyval, instruction(Op_push_i));
+			yyval->nexti->memory = dupnode(Nnull_string);
 		} else
-			(yyval) = list_append((yyvsp[(2) - (3)]), (yyvsp[(1) - (3)]));
+			yyval = list_append(yyvsp[-1], yyvsp[-2]);
 	  }
+#line 2669 "awkgram.c"
     break;
 
-  case 57:
-/* Line 1778 of yacc.c  */
-#line 841 "awkgram.y"
-    {
+  case 57: /* $@2: %empty  */
+#line 853 "awkgram.y"
+          {
 		if (! in_function)
 			yyerror(_("`return' used outside function context"));
 	  }
+#line 2678 "awkgram.c"
     break;
 
-  case 58:
-/* Line 1778 of yacc.c  */
-#line 844 "awkgram.y"
-    {
-		if ((yyvsp[(3) - (4)]) == NULL) {
-			(yyval) = list_create((yyvsp[(1) - (4)]));
-			(void) list_prepend((yyval), instruction(Op_push_i));
-			(yyval)->nexti->memory = dupnode(Nnull_string);
+  case 58: /* non_compound_stmt: LEX_RETURN $@2 opt_exp statement_term  */
+#line 856 "awkgram.y"
+                                   {
+		if (yyvsp[-1] == NULL) {
+			yyval = list_create(yyvsp[-3]);
+			(void) list_prepend(yyval, instruction(Op_push_i));
+			yyval->nexti->memory = dupnode(Nnull_string);
 		} else {
 			if (do_optimize > 1
-				&& (yyvsp[(3) - (4)])->lasti->opcode == Op_func_call
-				&& strcmp((yyvsp[(3) - (4)])->lasti->func_name, in_function) == 0
+				&& yyvsp[-1]->lasti->opcode == Op_func_call
+				&& strcmp(yyvsp[-1]->lasti->func_name, in_function) == 0
 			) {
 				/* Do tail recursion optimization. Tail
 				 * call without a return value is recognized
 				 * in mk_function().
 				 */
-				((yyvsp[(3) - (4)])->lasti + 1)->tail_call = true;
+				(yyvsp[-1]->lasti + 1)->tail_call = true;
 			}
 
-			(yyval) = list_append((yyvsp[(3) - (4)]), (yyvsp[(1) - (4)]));
+			yyval = list_append(yyvsp[-1], yyvsp[-3]);
 		}
 	  }
+#line 2703 "awkgram.c"
     break;
 
-  case 60:
-/* Line 1778 of yacc.c  */
-#line 876 "awkgram.y"
-    { in_print = true; in_parens = 0; }
+  case 60: /* $@3: %empty  */
+#line 888 "awkgram.y"
+                { in_print = true; in_parens = 0; }
+#line 2709 "awkgram.c"
     break;
 
-  case 61:
-/* Line 1778 of yacc.c  */
-#line 877 "awkgram.y"
-    {
+  case 61: /* simple_stmt: print $@3 print_expression_list output_redir  */
+#line 889 "awkgram.y"
+          {
 		/*
 		 * Optimization: plain `print' has no expression list, so $3 is null.
 		 * If $3 is NULL or is a bytecode list for $0 use Op_K_print_rec,
 		 * which is faster for these two cases.
 		 */
 
-		if ((yyvsp[(1) - (4)])->opcode == Op_K_print &&
-			((yyvsp[(3) - (4)]) == NULL
-				|| ((yyvsp[(3) - (4)])->lasti->opcode == Op_field_spec
-					&& (yyvsp[(3) - (4)])->nexti->nexti->nexti == (yyvsp[(3) - (4)])->lasti
-					&& (yyvsp[(3) - (4)])->nexti->nexti->opcode == Op_push_i
-					&& (yyvsp[(3) - (4)])->nexti->nexti->memory->type == Node_val)
+		if (yyvsp[-3]->opcode == Op_K_print &&
+			(yyvsp[-1] == NULL
+				|| (yyvsp[-1]->lasti->opcode == Op_field_spec
+					&& yyvsp[-1]->nexti->nexti->nexti == yyvsp[-1]->lasti
+					&& yyvsp[-1]->nexti->nexti->opcode == Op_push_i
+					&& yyvsp[-1]->nexti->nexti->memory->type == Node_val)
 			)
 		) {
 			static bool warned = false;
@@ -2878,37 +2733,37 @@ regular_loop:
 			 *    [Op_K_print_rec | NULL | redir_type | expr_count]
 			 */
 
-			if ((yyvsp[(3) - (4)]) != NULL) {
-				NODE *n = (yyvsp[(3) - (4)])->nexti->nexti->memory;
+			if (yyvsp[-1] != NULL) {
+				NODE *n = yyvsp[-1]->nexti->nexti->memory;
 
 				if (! iszero(n))
 					goto regular_print;
 
-				bcfree((yyvsp[(3) - (4)])->lasti);			/* Op_field_spec */
+				bcfree(yyvsp[-1]->lasti);			/* Op_field_spec */
 				unref(n);				/* Node_val */
-				bcfree((yyvsp[(3) - (4)])->nexti->nexti);		/* Op_push_i */
-				bcfree((yyvsp[(3) - (4)])->nexti);			/* Op_list */
-				bcfree((yyvsp[(3) - (4)]));				/* Op_list */
+				bcfree(yyvsp[-1]->nexti->nexti);		/* Op_push_i */
+				bcfree(yyvsp[-1]->nexti);			/* Op_list */
+				bcfree(yyvsp[-1]);				/* Op_list */
 			} else {
 				if (do_lint && (rule == BEGIN || rule == END) && ! warned) {
 					warned = true;
-					lintwarn_ln((yyvsp[(1) - (4)])->source_line,
+					lintwarn_ln(yyvsp[-3]->source_line,
 		_("plain `print' in BEGIN or END rule should probably be `print \"\"'"));
 				}
 			}
 
-			(yyvsp[(1) - (4)])->expr_count = 0;
-			(yyvsp[(1) - (4)])->opcode = Op_K_print_rec;
-			if ((yyvsp[(4) - (4)]) == NULL) {    /* no redircetion */
-				(yyvsp[(1) - (4)])->redir_type = redirect_none;
-				(yyval) = list_create((yyvsp[(1) - (4)]));
+			yyvsp[-3]->expr_count = 0;
+			yyvsp[-3]->opcode = Op_K_print_rec;
+			if (yyvsp[0] == NULL) {    /* no redircetion */
+				yyvsp[-3]->redir_type = redirect_none;
+				yyval = list_create(yyvsp[-3]);
 			} else {
 				INSTRUCTION *ip;
-				ip = (yyvsp[(4) - (4)])->nexti;
-				(yyvsp[(1) - (4)])->redir_type = ip->redir_type;
-				(yyvsp[(4) - (4)])->nexti = ip->nexti;
+				ip = yyvsp[0]->nexti;
+				yyvsp[-3]->redir_type = ip->redir_type;
+				yyvsp[0]->nexti = ip->nexti;
 				bcfree(ip);
-				(yyval) = list_append((yyvsp[(4) - (4)]), (yyvsp[(1) - (4)]));
+				yyval = list_append(yyvsp[0], yyvsp[-3]);
 			}
 		} else {
 			/*   -----------------
@@ -2921,59 +2776,59 @@ regular_loop:
 			 *
 			 */
 regular_print:	 
-			if ((yyvsp[(4) - (4)]) == NULL) {		/* no redirection */
-				if ((yyvsp[(3) - (4)]) == NULL)	{	/* printf without arg */
-					(yyvsp[(1) - (4)])->expr_count = 0;
-					(yyvsp[(1) - (4)])->redir_type = redirect_none;
-					(yyval) = list_create((yyvsp[(1) - (4)]));
+			if (yyvsp[0] == NULL) {		/* no redirection */
+				if (yyvsp[-1] == NULL)	{	/* printf without arg */
+					yyvsp[-3]->expr_count = 0;
+					yyvsp[-3]->redir_type = redirect_none;
+					yyval = list_create(yyvsp[-3]);
 				} else {
-					INSTRUCTION *t = (yyvsp[(3) - (4)]);
-					(yyvsp[(1) - (4)])->expr_count = count_expressions(&t, false);
-					(yyvsp[(1) - (4)])->redir_type = redirect_none;
-					(yyval) = list_append(t, (yyvsp[(1) - (4)]));
+					INSTRUCTION *t = yyvsp[-1];
+					yyvsp[-3]->expr_count = count_expressions(&t, false);
+					yyvsp[-3]->redir_type = redirect_none;
+					yyval = list_append(t, yyvsp[-3]);
 				}
 			} else {
 				INSTRUCTION *ip;
-				ip = (yyvsp[(4) - (4)])->nexti;
-				(yyvsp[(1) - (4)])->redir_type = ip->redir_type;
-				(yyvsp[(4) - (4)])->nexti = ip->nexti;
+				ip = yyvsp[0]->nexti;
+				yyvsp[-3]->redir_type = ip->redir_type;
+				yyvsp[0]->nexti = ip->nexti;
 				bcfree(ip);
-				if ((yyvsp[(3) - (4)]) == NULL) {
-					(yyvsp[(1) - (4)])->expr_count = 0;
-					(yyval) = list_append((yyvsp[(4) - (4)]), (yyvsp[(1) - (4)]));
+				if (yyvsp[-1] == NULL) {
+					yyvsp[-3]->expr_count = 0;
+					yyval = list_append(yyvsp[0], yyvsp[-3]);
 				} else {
-					INSTRUCTION *t = (yyvsp[(3) - (4)]);
-					(yyvsp[(1) - (4)])->expr_count = count_expressions(&t, false);
-					(yyval) = list_append(list_merge((yyvsp[(4) - (4)]), t), (yyvsp[(1) - (4)]));
+					INSTRUCTION *t = yyvsp[-1];
+					yyvsp[-3]->expr_count = count_expressions(&t, false);
+					yyval = list_append(list_merge(yyvsp[0], t), yyvsp[-3]);
 				}
 			}
 		}
 	  }
+#line 2810 "awkgram.c"
     break;
 
-  case 62:
-/* Line 1778 of yacc.c  */
-#line 974 "awkgram.y"
-    { sub_counter = 0; }
+  case 62: /* $@4: %empty  */
+#line 986 "awkgram.y"
+                          { sub_counter = 0; }
+#line 2816 "awkgram.c"
     break;
 
-  case 63:
-/* Line 1778 of yacc.c  */
-#line 975 "awkgram.y"
-    {
-		char *arr = (yyvsp[(2) - (4)])->lextok;
+  case 63: /* simple_stmt: LEX_DELETE NAME $@4 delete_subscript_list  */
+#line 987 "awkgram.y"
+          {
+		char *arr = yyvsp[-2]->lextok;
 
-		(yyvsp[(2) - (4)])->opcode = Op_push_array;
-		(yyvsp[(2) - (4)])->memory = variable((yyvsp[(2) - (4)])->source_line, arr, Node_var_new);
+		yyvsp[-2]->opcode = Op_push_array;
+		yyvsp[-2]->memory = variable(yyvsp[-2]->source_line, arr, Node_var_new);
 
 		if (! do_posix && ! do_traditional) {
-			if ((yyvsp[(2) - (4)])->memory == symbol_table)
+			if (yyvsp[-2]->memory == symbol_table)
 				fatal(_("`delete' is not allowed with SYMTAB"));
-			else if ((yyvsp[(2) - (4)])->memory == func_table)
+			else if (yyvsp[-2]->memory == func_table)
 				fatal(_("`delete' is not allowed with FUNCTAB"));
 		}
 
-		if ((yyvsp[(4) - (4)]) == NULL) {
+		if (yyvsp[0] == NULL) {
 			/*
 			 * As of September 2012, POSIX has added support
 			 * for `delete array'. See:
@@ -2985,513 +2840,534 @@ regular_print:
 			 * Also, since BWK awk supports it, we don't have to
 			 * check do_traditional either.
 			 */
-			(yyvsp[(1) - (4)])->expr_count = 0;
-			(yyval) = list_append(list_create((yyvsp[(2) - (4)])), (yyvsp[(1) - (4)]));
+			yyvsp[-3]->expr_count = 0;
+			yyval = list_append(list_create(yyvsp[-2]), yyvsp[-3]);
 		} else {
-			(yyvsp[(1) - (4)])->expr_count = sub_counter;
-			(yyval) = list_append(list_append((yyvsp[(4) - (4)]), (yyvsp[(2) - (4)])), (yyvsp[(1) - (4)]));
+			yyvsp[-3]->expr_count = sub_counter;
+			yyval = list_append(list_append(yyvsp[0], yyvsp[-2]), yyvsp[-3]);
 		}
 	  }
+#line 2853 "awkgram.c"
     break;
 
-  case 64:
-/* Line 1778 of yacc.c  */
-#line 1012 "awkgram.y"
-    {
+  case 64: /* simple_stmt: LEX_DELETE '(' NAME ')'  */
+#line 1024 "awkgram.y"
+          {
 		static bool warned = false;
-		char *arr = (yyvsp[(3) - (4)])->lextok;
+		char *arr = yyvsp[-1]->lextok;
 
 		if (do_lint && ! warned) {
 			warned = true;
-			lintwarn_ln((yyvsp[(1) - (4)])->source_line,
+			lintwarn_ln(yyvsp[-3]->source_line,
 				_("`delete(array)' is a non-portable tawk extension"));
 		}
 		if (do_traditional) {
-			error_ln((yyvsp[(1) - (4)])->source_line,
+			error_ln(yyvsp[-3]->source_line,
 				_("`delete(array)' is a non-portable tawk extension"));
 		}
-		(yyvsp[(3) - (4)])->memory = variable((yyvsp[(3) - (4)])->source_line, arr, Node_var_new);
-		(yyvsp[(3) - (4)])->opcode = Op_push_array;
-		(yyvsp[(1) - (4)])->expr_count = 0;
-		(yyval) = list_append(list_create((yyvsp[(3) - (4)])), (yyvsp[(1) - (4)]));
+		yyvsp[-1]->memory = variable(yyvsp[-1]->source_line, arr, Node_var_new);
+		yyvsp[-1]->opcode = Op_push_array;
+		yyvsp[-3]->expr_count = 0;
+		yyval = list_append(list_create(yyvsp[-1]), yyvsp[-3]);
 
 		if (! do_posix && ! do_traditional) {
-			if ((yyvsp[(3) - (4)])->memory == symbol_table)
+			if (yyvsp[-1]->memory == symbol_table)
 				fatal(_("`delete' is not allowed with SYMTAB"));
-			else if ((yyvsp[(3) - (4)])->memory == func_table)
+			else if (yyvsp[-1]->memory == func_table)
 				fatal(_("`delete' is not allowed with FUNCTAB"));
 		}
 	  }
+#line 2883 "awkgram.c"
     break;
 
-  case 65:
-/* Line 1778 of yacc.c  */
-#line 1038 "awkgram.y"
-    {	(yyval) = optimize_assignment((yyvsp[(1) - (1)])); }
+  case 65: /* simple_stmt: exp  */
+#line 1050 "awkgram.y"
+          {	yyval = optimize_assignment(yyvsp[0]); }
+#line 2889 "awkgram.c"
     break;
 
-  case 66:
-/* Line 1778 of yacc.c  */
-#line 1043 "awkgram.y"
-    { (yyval) = NULL; }
+  case 66: /* opt_simple_stmt: %empty  */
+#line 1055 "awkgram.y"
+          { yyval = NULL; }
+#line 2895 "awkgram.c"
     break;
 
-  case 67:
-/* Line 1778 of yacc.c  */
-#line 1045 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 67: /* opt_simple_stmt: simple_stmt  */
+#line 1057 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 2901 "awkgram.c"
     break;
 
-  case 68:
-/* Line 1778 of yacc.c  */
-#line 1050 "awkgram.y"
-    { (yyval) = NULL; }
+  case 68: /* case_statements: %empty  */
+#line 1062 "awkgram.y"
+          { yyval = NULL; }
+#line 2907 "awkgram.c"
     break;
 
-  case 69:
-/* Line 1778 of yacc.c  */
-#line 1052 "awkgram.y"
-    {
-		if ((yyvsp[(1) - (2)]) == NULL)
-			(yyval) = list_create((yyvsp[(2) - (2)]));
+  case 69: /* case_statements: case_statements case_statement  */
+#line 1064 "awkgram.y"
+          {
+		if (yyvsp[-1] == NULL)
+			yyval = list_create(yyvsp[0]);
 		else
-			(yyval) = list_prepend((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)]));
+			yyval = list_prepend(yyvsp[-1], yyvsp[0]);
 	  }
+#line 2918 "awkgram.c"
     break;
 
-  case 70:
-/* Line 1778 of yacc.c  */
-#line 1059 "awkgram.y"
-    { (yyval) = NULL; }
+  case 70: /* case_statements: case_statements error  */
+#line 1071 "awkgram.y"
+          { yyval = NULL; }
+#line 2924 "awkgram.c"
     break;
 
-  case 71:
-/* Line 1778 of yacc.c  */
-#line 1064 "awkgram.y"
-    {
-		INSTRUCTION *casestmt = (yyvsp[(5) - (5)]);
-		if ((yyvsp[(5) - (5)]) == NULL)
+  case 71: /* case_statement: LEX_CASE case_value colon opt_nls statements  */
+#line 1076 "awkgram.y"
+          {
+		INSTRUCTION *casestmt = yyvsp[0];
+		if (yyvsp[0] == NULL)
 			casestmt = list_create(instruction(Op_no_op));	
 		if (do_pretty_print)
 			(void) list_prepend(casestmt, instruction(Op_exec_count));
-		(yyvsp[(1) - (5)])->case_exp = (yyvsp[(2) - (5)]);
-		(yyvsp[(1) - (5)])->case_stmt = casestmt;
-		bcfree((yyvsp[(3) - (5)]));
-		(yyval) = (yyvsp[(1) - (5)]);
+		yyvsp[-4]->case_exp = yyvsp[-3];
+		yyvsp[-4]->case_stmt = casestmt;
+		bcfree(yyvsp[-2]);
+		yyval = yyvsp[-4];
 	  }
+#line 2940 "awkgram.c"
     break;
 
-  case 72:
-/* Line 1778 of yacc.c  */
-#line 1076 "awkgram.y"
-    {
-		INSTRUCTION *casestmt = (yyvsp[(4) - (4)]);
-		if ((yyvsp[(4) - (4)]) == NULL)
+  case 72: /* case_statement: LEX_DEFAULT colon opt_nls statements  */
+#line 1088 "awkgram.y"
+          {
+		INSTRUCTION *casestmt = yyvsp[0];
+		if (yyvsp[0] == NULL)
 			casestmt = list_create(instruction(Op_no_op));
 		if (do_pretty_print)
 			(void) list_prepend(casestmt, instruction(Op_exec_count));
-		bcfree((yyvsp[(2) - (4)]));
-		(yyvsp[(1) - (4)])->case_stmt = casestmt;
-		(yyval) = (yyvsp[(1) - (4)]);
+		bcfree(yyvsp[-2]);
+		yyvsp[-3]->case_stmt = casestmt;
+		yyval = yyvsp[-3];
 	  }
+#line 2955 "awkgram.c"
     break;
 
-  case 73:
-/* Line 1778 of yacc.c  */
-#line 1090 "awkgram.y"
-    {	(yyval) = (yyvsp[(1) - (1)]); }
+  case 73: /* case_value: YNUMBER  */
+#line 1102 "awkgram.y"
+          {	yyval = yyvsp[0]; }
+#line 2961 "awkgram.c"
     break;
 
-  case 74:
-/* Line 1778 of yacc.c  */
-#line 1092 "awkgram.y"
-    { 
-		NODE *n = (yyvsp[(2) - (2)])->memory;
+  case 74: /* case_value: '-' YNUMBER  */
+#line 1104 "awkgram.y"
+          { 
+		NODE *n = yyvsp[0]->memory;
 		(void) force_number(n);
 		negate_num(n);
-		bcfree((yyvsp[(1) - (2)]));
-		(yyval) = (yyvsp[(2) - (2)]);
+		bcfree(yyvsp[-1]);
+		yyval = yyvsp[0];
 	  }
+#line 2973 "awkgram.c"
     break;
 
-  case 75:
-/* Line 1778 of yacc.c  */
-#line 1100 "awkgram.y"
-    {
-		bcfree((yyvsp[(1) - (2)]));
-		(yyval) = (yyvsp[(2) - (2)]);
+  case 75: /* case_value: '+' YNUMBER  */
+#line 1112 "awkgram.y"
+          {
+		bcfree(yyvsp[-1]);
+		yyval = yyvsp[0];
 	  }
+#line 2982 "awkgram.c"
     break;
 
-  case 76:
-/* Line 1778 of yacc.c  */
-#line 1105 "awkgram.y"
-    {	(yyval) = (yyvsp[(1) - (1)]); }
+  case 76: /* case_value: YSTRING  */
+#line 1117 "awkgram.y"
+          {	yyval = yyvsp[0]; }
+#line 2988 "awkgram.c"
     break;
 
-  case 77:
-/* Line 1778 of yacc.c  */
-#line 1107 "awkgram.y"
-    {
-		(yyvsp[(1) - (1)])->opcode = Op_push_re;
-		(yyval) = (yyvsp[(1) - (1)]);
+  case 77: /* case_value: regexp  */
+#line 1119 "awkgram.y"
+          {
+		yyvsp[0]->opcode = Op_push_re;
+		yyval = yyvsp[0];
 	  }
+#line 2997 "awkgram.c"
     break;
 
-  case 78:
-/* Line 1778 of yacc.c  */
-#line 1115 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 78: /* print: LEX_PRINT  */
+#line 1127 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3003 "awkgram.c"
     break;
 
-  case 79:
-/* Line 1778 of yacc.c  */
-#line 1117 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 79: /* print: LEX_PRINTF  */
+#line 1129 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3009 "awkgram.c"
     break;
 
-  case 81:
-/* Line 1778 of yacc.c  */
-#line 1127 "awkgram.y"
-    {
-		(yyval) = (yyvsp[(2) - (3)]);
+  case 81: /* print_expression_list: '(' expression_list r_paren  */
+#line 1139 "awkgram.y"
+          {
+		yyval = yyvsp[-1];
 	  }
+#line 3017 "awkgram.c"
     break;
 
-  case 82:
-/* Line 1778 of yacc.c  */
-#line 1134 "awkgram.y"
-    {
+  case 82: /* output_redir: %empty  */
+#line 1146 "awkgram.y"
+          {
 		in_print = false;
 		in_parens = 0;
-		(yyval) = NULL;
+		yyval = NULL;
 	  }
+#line 3027 "awkgram.c"
     break;
 
-  case 83:
-/* Line 1778 of yacc.c  */
-#line 1139 "awkgram.y"
-    { in_print = false; in_parens = 0; }
+  case 83: /* $@5: %empty  */
+#line 1151 "awkgram.y"
+                 { in_print = false; in_parens = 0; }
+#line 3033 "awkgram.c"
     break;
 
-  case 84:
-/* Line 1778 of yacc.c  */
-#line 1140 "awkgram.y"
-    {
-		if ((yyvsp[(1) - (3)])->redir_type == redirect_twoway
-		    	&& (yyvsp[(3) - (3)])->lasti->opcode == Op_K_getline_redir
-		   	 	&& (yyvsp[(3) - (3)])->lasti->redir_type == redirect_twoway)
+  case 84: /* output_redir: IO_OUT $@5 common_exp  */
+#line 1152 "awkgram.y"
+          {
+		if (yyvsp[-2]->redir_type == redirect_twoway
+		    	&& yyvsp[0]->lasti->opcode == Op_K_getline_redir
+		   	 	&& yyvsp[0]->lasti->redir_type == redirect_twoway)
 			yyerror(_("multistage two-way pipelines don't work"));
-		(yyval) = list_prepend((yyvsp[(3) - (3)]), (yyvsp[(1) - (3)]));
+		yyval = list_prepend(yyvsp[0], yyvsp[-2]);
 	  }
+#line 3045 "awkgram.c"
     break;
 
-  case 85:
-/* Line 1778 of yacc.c  */
-#line 1151 "awkgram.y"
-    {
-		(yyval) = mk_condition((yyvsp[(3) - (6)]), (yyvsp[(1) - (6)]), (yyvsp[(6) - (6)]), NULL, NULL);
+  case 85: /* if_statement: LEX_IF '(' exp r_paren opt_nls statement  */
+#line 1163 "awkgram.y"
+          {
+		yyval = mk_condition(yyvsp[-3], yyvsp[-5], yyvsp[0], NULL, NULL);
 	  }
+#line 3053 "awkgram.c"
     break;
 
-  case 86:
-/* Line 1778 of yacc.c  */
-#line 1156 "awkgram.y"
-    {
-		(yyval) = mk_condition((yyvsp[(3) - (9)]), (yyvsp[(1) - (9)]), (yyvsp[(6) - (9)]), (yyvsp[(7) - (9)]), (yyvsp[(9) - (9)]));
+  case 86: /* if_statement: LEX_IF '(' exp r_paren opt_nls statement LEX_ELSE opt_nls statement  */
+#line 1168 "awkgram.y"
+          {
+		yyval = mk_condition(yyvsp[-6], yyvsp[-8], yyvsp[-3], yyvsp[-2], yyvsp[0]);
 	  }
+#line 3061 "awkgram.c"
     break;
 
-  case 91:
-/* Line 1778 of yacc.c  */
-#line 1173 "awkgram.y"
-    { (yyval) = NULL; }
+  case 91: /* input_redir: %empty  */
+#line 1185 "awkgram.y"
+          { yyval = NULL; }
+#line 3067 "awkgram.c"
     break;
 
-  case 92:
-/* Line 1778 of yacc.c  */
-#line 1175 "awkgram.y"
-    {
-		bcfree((yyvsp[(1) - (2)]));
-		(yyval) = (yyvsp[(2) - (2)]);
+  case 92: /* input_redir: '<' simp_exp  */
+#line 1187 "awkgram.y"
+          {
+		bcfree(yyvsp[-1]);
+		yyval = yyvsp[0];
 	  }
+#line 3076 "awkgram.c"
     break;
 
-  case 93:
-/* Line 1778 of yacc.c  */
-#line 1183 "awkgram.y"
-    { (yyval) = NULL; }
+  case 93: /* opt_param_list: %empty  */
+#line 1195 "awkgram.y"
+          { yyval = NULL; }
+#line 3082 "awkgram.c"
     break;
 
-  case 94:
-/* Line 1778 of yacc.c  */
-#line 1185 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]) ; }
+  case 94: /* opt_param_list: param_list  */
+#line 1197 "awkgram.y"
+          { yyval = yyvsp[0] ; }
+#line 3088 "awkgram.c"
     break;
 
-  case 95:
-/* Line 1778 of yacc.c  */
-#line 1190 "awkgram.y"
-    {
-		(yyvsp[(1) - (1)])->param_count = 0;
-		(yyval) = list_create((yyvsp[(1) - (1)]));
+  case 95: /* param_list: NAME  */
+#line 1202 "awkgram.y"
+          {
+		yyvsp[0]->param_count = 0;
+		yyval = list_create(yyvsp[0]);
 	  }
+#line 3097 "awkgram.c"
     break;
 
-  case 96:
-/* Line 1778 of yacc.c  */
-#line 1195 "awkgram.y"
-    {
-		(yyvsp[(3) - (3)])->param_count =  (yyvsp[(1) - (3)])->lasti->param_count + 1;
-		(yyval) = list_append((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]));
+  case 96: /* param_list: param_list comma NAME  */
+#line 1207 "awkgram.y"
+          {
+		yyvsp[0]->param_count =  yyvsp[-2]->lasti->param_count + 1;
+		yyval = list_append(yyvsp[-2], yyvsp[0]);
 		yyerrok;
 	  }
+#line 3107 "awkgram.c"
     break;
 
-  case 97:
-/* Line 1778 of yacc.c  */
-#line 1201 "awkgram.y"
-    { (yyval) = NULL; }
+  case 97: /* param_list: error  */
+#line 1213 "awkgram.y"
+          { yyval = NULL; }
+#line 3113 "awkgram.c"
     break;
 
-  case 98:
-/* Line 1778 of yacc.c  */
-#line 1203 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (2)]); }
+  case 98: /* param_list: param_list error  */
+#line 1215 "awkgram.y"
+          { yyval = yyvsp[-1]; }
+#line 3119 "awkgram.c"
     break;
 
-  case 99:
-/* Line 1778 of yacc.c  */
-#line 1205 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (3)]); }
+  case 99: /* param_list: param_list comma error  */
+#line 1217 "awkgram.y"
+          { yyval = yyvsp[-2]; }
+#line 3125 "awkgram.c"
     break;
 
-  case 100:
-/* Line 1778 of yacc.c  */
-#line 1211 "awkgram.y"
-    { (yyval) = NULL; }
+  case 100: /* opt_exp: %empty  */
+#line 1223 "awkgram.y"
+          { yyval = NULL; }
+#line 3131 "awkgram.c"
     break;
 
-  case 101:
-/* Line 1778 of yacc.c  */
-#line 1213 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 101: /* opt_exp: exp  */
+#line 1225 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3137 "awkgram.c"
     break;
 
-  case 102:
-/* Line 1778 of yacc.c  */
-#line 1218 "awkgram.y"
-    { (yyval) = NULL; }
+  case 102: /* opt_expression_list: %empty  */
+#line 1230 "awkgram.y"
+          { yyval = NULL; }
+#line 3143 "awkgram.c"
     break;
 
-  case 103:
-/* Line 1778 of yacc.c  */
-#line 1220 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 103: /* opt_expression_list: expression_list  */
+#line 1232 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3149 "awkgram.c"
     break;
 
-  case 104:
-/* Line 1778 of yacc.c  */
-#line 1225 "awkgram.y"
-    {	(yyval) = mk_expression_list(NULL, (yyvsp[(1) - (1)])); }
+  case 104: /* expression_list: exp  */
+#line 1237 "awkgram.y"
+          {	yyval = mk_expression_list(NULL, yyvsp[0]); }
+#line 3155 "awkgram.c"
     break;
 
-  case 105:
-/* Line 1778 of yacc.c  */
-#line 1227 "awkgram.y"
-    {
-		(yyval) = mk_expression_list((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]));
+  case 105: /* expression_list: expression_list comma exp  */
+#line 1239 "awkgram.y"
+          {
+		yyval = mk_expression_list(yyvsp[-2], yyvsp[0]);
 		yyerrok;
 	  }
+#line 3164 "awkgram.c"
     break;
 
-  case 106:
-/* Line 1778 of yacc.c  */
-#line 1232 "awkgram.y"
-    { (yyval) = NULL; }
+  case 106: /* expression_list: error  */
+#line 1244 "awkgram.y"
+          { yyval = NULL; }
+#line 3170 "awkgram.c"
     break;
 
-  case 107:
-/* Line 1778 of yacc.c  */
-#line 1234 "awkgram.y"
-    { (yyval) = NULL; }
+  case 107: /* expression_list: expression_list error  */
+#line 1246 "awkgram.y"
+          { yyval = NULL; }
+#line 3176 "awkgram.c"
     break;
 
-  case 108:
-/* Line 1778 of yacc.c  */
-#line 1236 "awkgram.y"
-    { (yyval) = NULL; }
+  case 108: /* expression_list: expression_list error exp  */
+#line 1248 "awkgram.y"
+          { yyval = NULL; }
+#line 3182 "awkgram.c"
     break;
 
-  case 109:
-/* Line 1778 of yacc.c  */
-#line 1238 "awkgram.y"
-    { (yyval) = NULL; }
+  case 109: /* expression_list: expression_list comma error  */
+#line 1250 "awkgram.y"
+          { yyval = NULL; }
+#line 3188 "awkgram.c"
     break;
 
-  case 110:
-/* Line 1778 of yacc.c  */
-#line 1244 "awkgram.y"
-    {
-		if (do_lint && (yyvsp[(3) - (3)])->lasti->opcode == Op_match_rec)
-			lintwarn_ln((yyvsp[(2) - (3)])->source_line,
+  case 110: /* exp: variable assign_operator exp  */
+#line 1256 "awkgram.y"
+          {
+		if (do_lint && yyvsp[0]->lasti->opcode == Op_match_rec)
+			lintwarn_ln(yyvsp[-1]->source_line,
 				_("regular expression on right of assignment"));
-		(yyval) = mk_assignment((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)]));
+		yyval = mk_assignment(yyvsp[-2], yyvsp[0], yyvsp[-1]);
 	  }
+#line 3199 "awkgram.c"
     break;
 
-  case 111:
-/* Line 1778 of yacc.c  */
-#line 1251 "awkgram.y"
-    {	(yyval) = mk_boolean((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 111: /* exp: exp LEX_AND exp  */
+#line 1263 "awkgram.y"
+          {	yyval = mk_boolean(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3205 "awkgram.c"
     break;
 
-  case 112:
-/* Line 1778 of yacc.c  */
-#line 1253 "awkgram.y"
-    {	(yyval) = mk_boolean((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 112: /* exp: exp LEX_OR exp  */
+#line 1265 "awkgram.y"
+          {	yyval = mk_boolean(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3211 "awkgram.c"
     break;
 
-  case 113:
-/* Line 1778 of yacc.c  */
-#line 1255 "awkgram.y"
-    {
-		if ((yyvsp[(1) - (3)])->lasti->opcode == Op_match_rec)
-			warning_ln((yyvsp[(2) - (3)])->source_line,
+  case 113: /* exp: exp MATCHOP exp  */
+#line 1267 "awkgram.y"
+          {
+		if (yyvsp[-2]->lasti->opcode == Op_match_rec)
+			warning_ln(yyvsp[-1]->source_line,
 				_("regular expression on left of `~' or `!~' operator"));
 
-		if ((yyvsp[(3) - (3)])->lasti == (yyvsp[(3) - (3)])->nexti && (yyvsp[(3) - (3)])->nexti->opcode == Op_match_rec) {
-			(yyvsp[(2) - (3)])->memory = (yyvsp[(3) - (3)])->nexti->memory;
-			bcfree((yyvsp[(3) - (3)])->nexti);	/* Op_match_rec */
-			bcfree((yyvsp[(3) - (3)]));			/* Op_list */
-			(yyval) = list_append((yyvsp[(1) - (3)]), (yyvsp[(2) - (3)]));
+		const_regexp(yyvsp[0]);
+		if (yyvsp[0]->lasti == yyvsp[0]->nexti && yyvsp[0]->nexti->opcode == Op_match_rec) {
+			yyvsp[-1]->memory = yyvsp[0]->nexti->memory;
+			bcfree(yyvsp[0]->nexti);	/* Op_match_rec */
+			bcfree(yyvsp[0]);			/* Op_list */
+			yyval = list_append(yyvsp[-2], yyvsp[-1]);
 		} else {
-			(yyvsp[(2) - (3)])->memory = make_regnode(Node_dynregex, NULL);
-			(yyval) = list_append(list_merge((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)])), (yyvsp[(2) - (3)]));
+			yyvsp[-1]->memory = make_regnode(Node_dynregex, NULL);
+			yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), yyvsp[-1]);
 		}
 	  }
+#line 3232 "awkgram.c"
     break;
 
-  case 114:
-/* Line 1778 of yacc.c  */
-#line 1271 "awkgram.y"
-    {
+  case 114: /* exp: exp LEX_IN simple_variable  */
+#line 1284 "awkgram.y"
+          {
 		if (do_lint_old)
-			warning_ln((yyvsp[(2) - (3)])->source_line,
+			warning_ln(yyvsp[-1]->source_line,
 				_("old awk does not support the keyword `in' except after `for'"));
-		(yyvsp[(3) - (3)])->nexti->opcode = Op_push_array;
-		(yyvsp[(2) - (3)])->opcode = Op_in_array;
-		(yyvsp[(2) - (3)])->expr_count = 1;
-		(yyval) = list_append(list_merge((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)])), (yyvsp[(2) - (3)]));
+		yyvsp[0]->nexti->opcode = Op_push_array;
+		yyvsp[-1]->opcode = Op_in_array;
+		yyvsp[-1]->expr_count = 1;
+		yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), yyvsp[-1]);
 	  }
+#line 3246 "awkgram.c"
     break;
 
-  case 115:
-/* Line 1778 of yacc.c  */
-#line 1281 "awkgram.y"
-    {
-		if (do_lint && (yyvsp[(3) - (3)])->lasti->opcode == Op_match_rec)
-			lintwarn_ln((yyvsp[(2) - (3)])->source_line,
+  case 115: /* exp: exp a_relop exp  */
+#line 1294 "awkgram.y"
+          {
+		INSTRUCTION *ip = yyvsp[0]->nexti;
+
+		if (do_lint && yyvsp[0]->lasti->opcode == Op_match_rec)
+			lintwarn_ln(yyvsp[-1]->source_line,
 				_("regular expression on right of comparison"));
-		(yyval) = list_append(list_merge((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)])), (yyvsp[(2) - (3)]));
+
+		if (fold_relop(yyvsp[-2], yyvsp[0], yyvsp[-1]))
+			yyval = yyvsp[-2];
+		/* convert (Op_push_i Node_val) + (Op_equal) to (Op_equal_i Node_val) */
+		else if (do_optimize && ! do_pretty_print
+				&& (yyvsp[-1]->opcode == Op_equal || yyvsp[-1]->opcode == Op_notequal)
+				&& ip == yyvsp[0]->lasti && ip->opcode == Op_push_i
+				&& (ip->memory->flags & INTLSTR) == 0
+		) {
+			yyvsp[-1]->opcode = (yyvsp[-1]->opcode == Op_equal ? Op_equal_i : Op_notequal_i);
+			yyvsp[-1]->memory = ip->memory;
+			bcfree(ip);
+			bcfree(yyvsp[0]);	/* Op_list */
+			yyval = list_append(yyvsp[-2], yyvsp[-1]);
+		} else
+			yyval = list_append(list_merge(yyvsp[-2], yyvsp[0]), yyvsp[-1]);
 	  }
+#line 3274 "awkgram.c"
     break;
 
-  case 116:
-/* Line 1778 of yacc.c  */
-#line 1288 "awkgram.y"
-    { (yyval) = mk_condition((yyvsp[(1) - (5)]), (yyvsp[(2) - (5)]), (yyvsp[(3) - (5)]), (yyvsp[(4) - (5)]), (yyvsp[(5) - (5)])); }
+  case 116: /* exp: exp '?' exp ':' exp  */
+#line 1318 "awkgram.y"
+          { yyval = mk_condition(yyvsp[-4], yyvsp[-3], yyvsp[-2], yyvsp[-1], yyvsp[0]); }
+#line 3280 "awkgram.c"
     break;
 
-  case 117:
-/* Line 1778 of yacc.c  */
-#line 1290 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 117: /* exp: common_exp  */
+#line 1320 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3286 "awkgram.c"
     break;
 
-  case 118:
-/* Line 1778 of yacc.c  */
-#line 1295 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 118: /* assign_operator: ASSIGN  */
+#line 1325 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3292 "awkgram.c"
     break;
 
-  case 119:
-/* Line 1778 of yacc.c  */
-#line 1297 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 119: /* assign_operator: ASSIGNOP  */
+#line 1327 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3298 "awkgram.c"
     break;
 
-  case 120:
-/* Line 1778 of yacc.c  */
-#line 1299 "awkgram.y"
-    {	
-		(yyvsp[(2) - (2)])->opcode = Op_assign_quotient;
-		(yyval) = (yyvsp[(2) - (2)]);
+  case 120: /* assign_operator: SLASH_BEFORE_EQUAL ASSIGN  */
+#line 1329 "awkgram.y"
+          {	
+		yyvsp[0]->opcode = Op_assign_quotient;
+		yyval = yyvsp[0];
 	  }
+#line 3307 "awkgram.c"
     break;
 
-  case 121:
-/* Line 1778 of yacc.c  */
-#line 1307 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 121: /* relop_or_less: RELOP  */
+#line 1337 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3313 "awkgram.c"
     break;
 
-  case 122:
-/* Line 1778 of yacc.c  */
-#line 1309 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 122: /* relop_or_less: '<'  */
+#line 1339 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3319 "awkgram.c"
     break;
 
-  case 123:
-/* Line 1778 of yacc.c  */
-#line 1314 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 123: /* a_relop: relop_or_less  */
+#line 1344 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3325 "awkgram.c"
     break;
 
-  case 124:
-/* Line 1778 of yacc.c  */
-#line 1316 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 124: /* a_relop: '>'  */
+#line 1346 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3331 "awkgram.c"
     break;
 
-  case 125:
-/* Line 1778 of yacc.c  */
-#line 1321 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 125: /* common_exp: simp_exp  */
+#line 1351 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3337 "awkgram.c"
     break;
 
-  case 126:
-/* Line 1778 of yacc.c  */
-#line 1323 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 126: /* common_exp: simp_exp_nc  */
+#line 1353 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3343 "awkgram.c"
     break;
 
-  case 127:
-/* Line 1778 of yacc.c  */
-#line 1325 "awkgram.y"
-    {
+  case 127: /* common_exp: common_exp simp_exp  */
+#line 1355 "awkgram.y"
+          {
 		int count = 2;
 		bool is_simple_var = false;
 
-		if ((yyvsp[(1) - (2)])->lasti->opcode == Op_concat) {
+		if (yyvsp[-1]->lasti->opcode == Op_concat) {
 			/* multiple (> 2) adjacent strings optimization */
-			is_simple_var = ((yyvsp[(1) - (2)])->lasti->concat_flag & CSVAR);
-			count = (yyvsp[(1) - (2)])->lasti->expr_count + 1;
-			(yyvsp[(1) - (2)])->lasti->opcode = Op_no_op;
+			is_simple_var = (yyvsp[-1]->lasti->concat_flag & CSVAR);
+			count = yyvsp[-1]->lasti->expr_count + 1;
+			yyvsp[-1]->lasti->opcode = Op_no_op;
 		} else {
-			is_simple_var = ((yyvsp[(1) - (2)])->nexti->opcode == Op_push
-					&& (yyvsp[(1) - (2)])->lasti == (yyvsp[(1) - (2)])->nexti); /* first exp. is a simple
+			is_simple_var = (yyvsp[-1]->nexti->opcode == Op_push
+					&& yyvsp[-1]->lasti == yyvsp[-1]->nexti); /* first exp. is a simple
 					                             * variable?; kludge for use
 					                             * in Op_assign_concat.
 		 			                             */
 		}
 
-		if (do_optimize > 1
-			&& (yyvsp[(1) - (2)])->nexti == (yyvsp[(1) - (2)])->lasti && (yyvsp[(1) - (2)])->nexti->opcode == Op_push_i
-			&& (yyvsp[(2) - (2)])->nexti == (yyvsp[(2) - (2)])->lasti && (yyvsp[(2) - (2)])->nexti->opcode == Op_push_i
+		if (do_optimize > 1 && ! do_pretty_print
+			&& yyvsp[-1]->nexti == yyvsp[-1]->lasti && yyvsp[-1]->nexti->opcode == Op_push_i
+			&& yyvsp[0]->nexti == yyvsp[0]->lasti && yyvsp[0]->nexti->opcode == Op_push_i
+			/* a number's string value depends on CONVFMT at run time */
+			&& (yyvsp[-1]->nexti->memory->flags & STRING) != 0
+			&& (yyvsp[0]->nexti->memory->flags & STRING) != 0
 		) {
-			NODE *n1 = (yyvsp[(1) - (2)])->nexti->memory;
-			NODE *n2 = (yyvsp[(2) - (2)])->nexti->memory;
+			NODE *n1 = yyvsp[-1]->nexti->memory;
+			NODE *n2 = yyvsp[0]->nexti->memory;
 			size_t nlen;
 
 			n1 = force_string(n1);
@@ -3504,193 +3380,193 @@ regular_print:
 			n1->flags &= ~(NUMCUR|NUMBER|NUMINT);
 			n1->flags |= (STRING|STRCUR);
 			unref(n2);
-			bcfree((yyvsp[(2) - (2)])->nexti);
-			bcfree((yyvsp[(2) - (2)]));
-			(yyval) = (yyvsp[(1) - (2)]);
+			bcfree(yyvsp[0]->nexti);
+			bcfree(yyvsp[0]);
+			yyval = yyvsp[-1];
 		} else {
-			(yyval) = list_append(list_merge((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)])), instruction(Op_concat));
-			(yyval)->lasti->concat_flag = (is_simple_var ? CSVAR : 0);
-			(yyval)->lasti->expr_count = count;
+			yyval = list_append(list_merge(yyvsp[-1], yyvsp[0]), instruction(Op_concat));
+			yyval->lasti->concat_flag = (is_simple_var ? CSVAR : 0);
+			yyval->lasti->expr_count = count;
 			if (count > max_args)
 				max_args = count;
 		}
 	  }
+#line 3397 "awkgram.c"
     break;
 
-  case 129:
-/* Line 1778 of yacc.c  */
-#line 1377 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 129: /* simp_exp: simp_exp '^' simp_exp  */
+#line 1410 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3403 "awkgram.c"
     break;
 
-  case 130:
-/* Line 1778 of yacc.c  */
-#line 1379 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 130: /* simp_exp: simp_exp '*' simp_exp  */
+#line 1412 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3409 "awkgram.c"
     break;
 
-  case 131:
-/* Line 1778 of yacc.c  */
-#line 1381 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 131: /* simp_exp: simp_exp '/' simp_exp  */
+#line 1414 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3415 "awkgram.c"
     break;
 
-  case 132:
-/* Line 1778 of yacc.c  */
-#line 1383 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 132: /* simp_exp: simp_exp '%' simp_exp  */
+#line 1416 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3421 "awkgram.c"
     break;
 
-  case 133:
-/* Line 1778 of yacc.c  */
-#line 1385 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 133: /* simp_exp: simp_exp '+' simp_exp  */
+#line 1418 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3427 "awkgram.c"
     break;
 
-  case 134:
-/* Line 1778 of yacc.c  */
-#line 1387 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 134: /* simp_exp: simp_exp '-' simp_exp  */
+#line 1420 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3433 "awkgram.c"
     break;
 
-  case 135:
-/* Line 1778 of yacc.c  */
-#line 1389 "awkgram.y"
-    {
+  case 135: /* simp_exp: LEX_GETLINE opt_variable input_redir  */
+#line 1422 "awkgram.y"
+          {
 		/*
 		 * In BEGINFILE/ENDFILE, allow `getline var < file'
 		 */
 
 		if (rule == BEGINFILE || rule == ENDFILE) {
-			if ((yyvsp[(2) - (3)]) != NULL && (yyvsp[(3) - (3)]) != NULL)
+			if (yyvsp[-1] != NULL && yyvsp[0] != NULL)
 				;	 /* all  ok */
 			else {
-				if ((yyvsp[(2) - (3)]) != NULL)
-					error_ln((yyvsp[(1) - (3)])->source_line,
+				if (yyvsp[-1] != NULL)
+					error_ln(yyvsp[-2]->source_line,
 						_("`getline var' invalid inside `%s' rule"), ruletab[rule]);
 				else
-					error_ln((yyvsp[(1) - (3)])->source_line,
+					error_ln(yyvsp[-2]->source_line,
 						_("`getline' invalid inside `%s' rule"), ruletab[rule]);
 			}
 		}
-		if (do_lint && rule == END && (yyvsp[(3) - (3)]) == NULL)
-			lintwarn_ln((yyvsp[(1) - (3)])->source_line,
+		if (do_lint && rule == END && yyvsp[0] == NULL)
+			lintwarn_ln(yyvsp[-2]->source_line,
 				_("non-redirected `getline' undefined inside END action"));
-		(yyval) = mk_getline((yyvsp[(1) - (3)]), (yyvsp[(2) - (3)]), (yyvsp[(3) - (3)]), redirect_input);
+		yyval = mk_getline(yyvsp[-2], yyvsp[-1], yyvsp[0], redirect_input);
 	  }
+#line 3460 "awkgram.c"
     break;
 
-  case 136:
-/* Line 1778 of yacc.c  */
-#line 1412 "awkgram.y"
-    {
-		(yyvsp[(2) - (2)])->opcode = Op_postincrement;
-		(yyval) = mk_assignment((yyvsp[(1) - (2)]), NULL, (yyvsp[(2) - (2)]));
+  case 136: /* simp_exp: variable INCREMENT  */
+#line 1445 "awkgram.y"
+          {
+		yyvsp[0]->opcode = Op_postincrement;
+		yyval = mk_assignment(yyvsp[-1], NULL, yyvsp[0]);
 	  }
+#line 3469 "awkgram.c"
     break;
 
-  case 137:
-/* Line 1778 of yacc.c  */
-#line 1417 "awkgram.y"
-    {
-		(yyvsp[(2) - (2)])->opcode = Op_postdecrement;
-		(yyval) = mk_assignment((yyvsp[(1) - (2)]), NULL, (yyvsp[(2) - (2)]));
+  case 137: /* simp_exp: variable DECREMENT  */
+#line 1450 "awkgram.y"
+          {
+		yyvsp[0]->opcode = Op_postdecrement;
+		yyval = mk_assignment(yyvsp[-1], NULL, yyvsp[0]);
 	  }
+#line 3478 "awkgram.c"
     break;
 
-  case 138:
-/* Line 1778 of yacc.c  */
-#line 1422 "awkgram.y"
-    {
+  case 138: /* simp_exp: '(' expression_list r_paren LEX_IN simple_variable  */
+#line 1455 "awkgram.y"
+          {
 		if (do_lint_old) {
-		    warning_ln((yyvsp[(4) - (5)])->source_line,
+		    warning_ln(yyvsp[-1]->source_line,
 				_("old awk does not support the keyword `in' except after `for'"));
-		    warning_ln((yyvsp[(4) - (5)])->source_line,
+		    warning_ln(yyvsp[-1]->source_line,
 				_("old awk does not support multidimensional arrays"));
 		}
-		(yyvsp[(5) - (5)])->nexti->opcode = Op_push_array;
-		(yyvsp[(4) - (5)])->opcode = Op_in_array;
-		if ((yyvsp[(2) - (5)]) == NULL) {	/* error */
+		yyvsp[0]->nexti->opcode = Op_push_array;
+		yyvsp[-1]->opcode = Op_in_array;
+		if (yyvsp[-3] == NULL) {	/* error */
 			errcount++;
-			(yyvsp[(4) - (5)])->expr_count = 0;
-			(yyval) = list_merge((yyvsp[(5) - (5)]), (yyvsp[(4) - (5)]));
+			yyvsp[-1]->expr_count = 0;
+			yyval = list_merge(yyvsp[0], yyvsp[-1]);
 		} else {
-			INSTRUCTION *t = (yyvsp[(2) - (5)]);
-			(yyvsp[(4) - (5)])->expr_count = count_expressions(&t, false);
-			(yyval) = list_append(list_merge(t, (yyvsp[(5) - (5)])), (yyvsp[(4) - (5)]));
+			INSTRUCTION *t = yyvsp[-3];
+			yyvsp[-1]->expr_count = count_expressions(&t, false);
+			yyval = list_append(list_merge(t, yyvsp[0]), yyvsp[-1]);
 		}
 	  }
+#line 3502 "awkgram.c"
     break;
 
-  case 139:
-/* Line 1778 of yacc.c  */
-#line 1447 "awkgram.y"
-    {
-		  (yyval) = mk_getline((yyvsp[(3) - (4)]), (yyvsp[(4) - (4)]), (yyvsp[(1) - (4)]), (yyvsp[(2) - (4)])->redir_type);
-		  bcfree((yyvsp[(2) - (4)]));
+  case 139: /* simp_exp_nc: common_exp IO_IN LEX_GETLINE opt_variable  */
+#line 1480 "awkgram.y"
+                {
+		  yyval = mk_getline(yyvsp[-1], yyvsp[0], yyvsp[-3], yyvsp[-2]->redir_type);
+		  bcfree(yyvsp[-2]);
 		}
+#line 3511 "awkgram.c"
     break;
 
-  case 140:
-/* Line 1778 of yacc.c  */
-#line 1453 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 140: /* simp_exp_nc: simp_exp_nc '^' simp_exp  */
+#line 1486 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3517 "awkgram.c"
     break;
 
-  case 141:
-/* Line 1778 of yacc.c  */
-#line 1455 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 141: /* simp_exp_nc: simp_exp_nc '*' simp_exp  */
+#line 1488 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3523 "awkgram.c"
     break;
 
-  case 142:
-/* Line 1778 of yacc.c  */
-#line 1457 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 142: /* simp_exp_nc: simp_exp_nc '/' simp_exp  */
+#line 1490 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3529 "awkgram.c"
     break;
 
-  case 143:
-/* Line 1778 of yacc.c  */
-#line 1459 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 143: /* simp_exp_nc: simp_exp_nc '%' simp_exp  */
+#line 1492 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3535 "awkgram.c"
     break;
 
-  case 144:
-/* Line 1778 of yacc.c  */
-#line 1461 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 144: /* simp_exp_nc: simp_exp_nc '+' simp_exp  */
+#line 1494 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3541 "awkgram.c"
     break;
 
-  case 145:
-/* Line 1778 of yacc.c  */
-#line 1463 "awkgram.y"
-    { (yyval) = mk_binary((yyvsp[(1) - (3)]), (yyvsp[(3) - (3)]), (yyvsp[(2) - (3)])); }
+  case 145: /* simp_exp_nc: simp_exp_nc '-' simp_exp  */
+#line 1496 "awkgram.y"
+          { yyval = mk_binary(yyvsp[-2], yyvsp[0], yyvsp[-1]); }
+#line 3547 "awkgram.c"
     break;
 
-  case 146:
-/* Line 1778 of yacc.c  */
-#line 1468 "awkgram.y"
-    {
-		(yyval) = list_create((yyvsp[(1) - (1)]));
+  case 146: /* non_post_simp_exp: regexp  */
+#line 1501 "awkgram.y"
+          {
+		yyval = list_create(yyvsp[0]);
 	  }
+#line 3555 "awkgram.c"
     break;
 
-  case 147:
-/* Line 1778 of yacc.c  */
-#line 1472 "awkgram.y"
-    {
-		if ((yyvsp[(2) - (2)])->opcode == Op_match_rec) {
-			(yyvsp[(2) - (2)])->opcode = Op_nomatch;
-			(yyvsp[(1) - (2)])->opcode = Op_push_i;
-			(yyvsp[(1) - (2)])->memory = make_number(0.0);	
-			(yyval) = list_append(list_append(list_create((yyvsp[(1) - (2)])),
-						instruction(Op_field_spec)), (yyvsp[(2) - (2)]));
+  case 147: /* non_post_simp_exp: '!' simp_exp  */
+#line 1505 "awkgram.y"
+          {
+		if (yyvsp[0]->opcode == Op_match_rec) {
+			yyvsp[0]->opcode = Op_nomatch;
+			yyvsp[-1]->opcode = Op_push_i;
+			yyvsp[-1]->memory = make_unshared_number(0.0);	
+			yyval = list_append(list_append(list_create(yyvsp[-1]),
+						instruction(Op_field_spec)), yyvsp[0]);
 		} else {
-			if (do_optimize > 1 && (yyvsp[(2) - (2)])->nexti == (yyvsp[(2) - (2)])->lasti
-					&& (yyvsp[(2) - (2)])->nexti->opcode == Op_push_i
-					&& ((yyvsp[(2) - (2)])->nexti->memory->flags & (MPFN|MPZN)) == 0
+			if (do_optimize > 1 && yyvsp[0]->nexti == yyvsp[0]->lasti
+					&& yyvsp[0]->nexti->opcode == Op_push_i
+					&& (yyvsp[0]->nexti->memory->flags & (MPFN|MPZN)) == 0
 			) {
-				NODE *n = (yyvsp[(2) - (2)])->nexti->memory;
+				NODE *n = yyvsp[0]->nexti->memory;
 				if ((n->flags & (STRCUR|STRING)) != 0) {
 					n->numbr = (AWKNUM) (n->stlen == 0);
 					n->flags &= ~(STRCUR|STRING);
@@ -3700,140 +3576,140 @@ regular_print:
 					n->stlen = 0;
 				} else
 					n->numbr = (AWKNUM) (n->numbr == 0.0);
-				bcfree((yyvsp[(1) - (2)]));
-				(yyval) = (yyvsp[(2) - (2)]);
+				bcfree(yyvsp[-1]);
+				yyval = yyvsp[0];
 			} else {
-				(yyvsp[(1) - (2)])->opcode = Op_not;
-				add_lint((yyvsp[(2) - (2)]), LINT_assign_in_cond);
-				(yyval) = list_append((yyvsp[(2) - (2)]), (yyvsp[(1) - (2)]));
+				yyvsp[-1]->opcode = Op_not;
+				add_lint(yyvsp[0], LINT_assign_in_cond);
+				yyval = list_append(yyvsp[0], yyvsp[-1]);
 			}
 		}
 	   }
+#line 3591 "awkgram.c"
     break;
 
-  case 148:
-/* Line 1778 of yacc.c  */
-#line 1504 "awkgram.y"
-    { (yyval) = (yyvsp[(2) - (3)]); }
+  case 148: /* non_post_simp_exp: '(' exp r_paren  */
+#line 1537 "awkgram.y"
+          { yyval = yyvsp[-1]; }
+#line 3597 "awkgram.c"
     break;
 
-  case 149:
-/* Line 1778 of yacc.c  */
-#line 1506 "awkgram.y"
-    {
-		(yyval) = snode((yyvsp[(3) - (4)]), (yyvsp[(1) - (4)]));
-		if ((yyval) == NULL)
+  case 149: /* non_post_simp_exp: LEX_BUILTIN '(' opt_expression_list r_paren  */
+#line 1539 "awkgram.y"
+          {
+		yyval = snode(yyvsp[-1], yyvsp[-3]);
+		if (yyval == NULL)
 			YYABORT;
 	  }
+#line 3607 "awkgram.c"
     break;
 
-  case 150:
-/* Line 1778 of yacc.c  */
-#line 1512 "awkgram.y"
-    {
-		(yyval) = snode((yyvsp[(3) - (4)]), (yyvsp[(1) - (4)]));
-		if ((yyval) == NULL)
+  case 150: /* non_post_simp_exp: LEX_LENGTH '(' opt_expression_list r_paren  */
+#line 1545 "awkgram.y"
+          {
+		yyval = snode(yyvsp[-1], yyvsp[-3]);
+		if (yyval == NULL)
 			YYABORT;
 	  }
+#line 3617 "awkgram.c"
     break;
 
-  case 151:
-/* Line 1778 of yacc.c  */
-#line 1518 "awkgram.y"
-    {
+  case 151: /* non_post_simp_exp: LEX_LENGTH  */
+#line 1551 "awkgram.y"
+          {
 		static bool warned = false;
 
 		if (do_lint && ! warned) {
 			warned = true;
-			lintwarn_ln((yyvsp[(1) - (1)])->source_line,
+			lintwarn_ln(yyvsp[0]->source_line,
 				_("call of `length' without parentheses is not portable"));
 		}
-		(yyval) = snode(NULL, (yyvsp[(1) - (1)]));
-		if ((yyval) == NULL)
+		yyval = snode(NULL, yyvsp[0]);
+		if (yyval == NULL)
 			YYABORT;
 	  }
+#line 3634 "awkgram.c"
     break;
 
-  case 154:
-/* Line 1778 of yacc.c  */
-#line 1533 "awkgram.y"
-    {
-		(yyvsp[(1) - (2)])->opcode = Op_preincrement;
-		(yyval) = mk_assignment((yyvsp[(2) - (2)]), NULL, (yyvsp[(1) - (2)]));
+  case 154: /* non_post_simp_exp: INCREMENT variable  */
+#line 1566 "awkgram.y"
+          {
+		yyvsp[-1]->opcode = Op_preincrement;
+		yyval = mk_assignment(yyvsp[0], NULL, yyvsp[-1]);
 	  }
+#line 3643 "awkgram.c"
     break;
 
-  case 155:
-/* Line 1778 of yacc.c  */
-#line 1538 "awkgram.y"
-    {
-		(yyvsp[(1) - (2)])->opcode = Op_predecrement;
-		(yyval) = mk_assignment((yyvsp[(2) - (2)]), NULL, (yyvsp[(1) - (2)]));
+  case 155: /* non_post_simp_exp: DECREMENT variable  */
+#line 1571 "awkgram.y"
+          {
+		yyvsp[-1]->opcode = Op_predecrement;
+		yyval = mk_assignment(yyvsp[0], NULL, yyvsp[-1]);
 	  }
+#line 3652 "awkgram.c"
     break;
 
-  case 156:
-/* Line 1778 of yacc.c  */
-#line 1543 "awkgram.y"
-    {
-		(yyval) = list_create((yyvsp[(1) - (1)]));
+  case 156: /* non_post_simp_exp: YNUMBER  */
+#line 1576 "awkgram.y"
+          {
+		yyval = list_create(yyvsp[0]);
 	  }
+#line 3660 "awkgram.c"
     break;
 
-  case 157:
-/* Line 1778 of yacc.c  */
-#line 1547 "awkgram.y"
-    {
-		(yyval) = list_create((yyvsp[(1) - (1)]));
+  case 157: /* non_post_simp_exp: YSTRING  */
+#line 1580 "awkgram.y"
+          {
+		yyval = list_create(yyvsp[0]);
 	  }
+#line 3668 "awkgram.c"
     break;
 
-  case 158:
-/* Line 1778 of yacc.c  */
-#line 1551 "awkgram.y"
-    {
-		if ((yyvsp[(2) - (2)])->lasti->opcode == Op_push_i
-			&& ((yyvsp[(2) - (2)])->lasti->memory->flags & (STRCUR|STRING)) == 0
+  case 158: /* non_post_simp_exp: '-' simp_exp  */
+#line 1584 "awkgram.y"
+          {
+		if (yyvsp[0]->lasti->opcode == Op_push_i
+			&& (yyvsp[0]->lasti->memory->flags & (STRCUR|STRING)) == 0
 		) {
-			NODE *n = (yyvsp[(2) - (2)])->lasti->memory;
+			NODE *n = yyvsp[0]->lasti->memory;
 			(void) force_number(n);
 			negate_num(n);			
-			(yyval) = (yyvsp[(2) - (2)]);
-			bcfree((yyvsp[(1) - (2)]));
+			yyval = yyvsp[0];
+			bcfree(yyvsp[-1]);
 		} else {
-			(yyvsp[(1) - (2)])->opcode = Op_unary_minus;
-			(yyval) = list_append((yyvsp[(2) - (2)]), (yyvsp[(1) - (2)]));
+			yyvsp[-1]->opcode = Op_unary_minus;
+			yyval = list_append(yyvsp[0], yyvsp[-1]);
 		}
 	  }
+#line 3687 "awkgram.c"
     break;
 
-  case 159:
-/* Line 1778 of yacc.c  */
-#line 1566 "awkgram.y"
-    {
+  case 159: /* non_post_simp_exp: '+' simp_exp  */
+#line 1599 "awkgram.y"
+          {
 	    /*
 	     * was: $$ = $2
 	     * POSIX semantics: force a conversion to numeric type
 	     */
-		(yyvsp[(1) - (2)])->opcode = Op_plus_i;
-		(yyvsp[(1) - (2)])->memory = make_number(0.0);
-		(yyval) = list_append((yyvsp[(2) - (2)]), (yyvsp[(1) - (2)]));
+		yyvsp[-1]->opcode = Op_plus_i;
+		yyvsp[-1]->memory = make_unshared_number(0.0);
+		yyval = list_append(yyvsp[0], yyvsp[-1]);
 	  }
+#line 3701 "awkgram.c"
     break;
 
-  case 160:
-/* Line 1778 of yacc.c  */
-#line 1579 "awkgram.y"
-    {
-		func_use((yyvsp[(1) - (1)])->lasti->func_name, FUNC_USE);
-		(yyval) = (yyvsp[(1) - (1)]);
+  case 160: /* func_call: direct_func_call  */
+#line 1612 "awkgram.y"
+          {
+		func_use(yyvsp[0]->lasti->func_name, FUNC_USE);
+		yyval = yyvsp[0];
 	  }
+#line 3710 "awkgram.c"
     break;
 
-  case 161:
-/* Line 1778 of yacc.c  */
-#line 1584 "awkgram.y"
-    {
+  case 161: /* func_call: '@' direct_func_call  */
+#line 1617 "awkgram.y"
+          {
 		/* indirect function call */
 		INSTRUCTION *f, *t;
 		char *name;
@@ -3848,7 +3724,7 @@ regular_print:
 			lintwarn("%s", msg);
 		}
 		
-		f = (yyvsp[(2) - (2)])->lasti;
+		f = yyvsp[0]->lasti;
 		f->opcode = Op_indirect_func_call;
 		name = estrdup(f->func_name, strlen(f->func_name));
 		if (is_std_var(name))
@@ -3863,71 +3739,71 @@ regular_print:
 		 *		@f(f="real_fun")
 		 */
 
-		(yyval) = list_prepend((yyvsp[(2) - (2)]), t);
+		yyval = list_prepend(yyvsp[0], t);
 	  }
+#line 3747 "awkgram.c"
     break;
 
-  case 162:
-/* Line 1778 of yacc.c  */
-#line 1620 "awkgram.y"
-    {
-		param_sanity((yyvsp[(3) - (4)]));
-		(yyvsp[(1) - (4)])->opcode = Op_func_call;
-		(yyvsp[(1) - (4)])->func_body = NULL;
-		if ((yyvsp[(3) - (4)]) == NULL) {	/* no argument or error */
-			((yyvsp[(1) - (4)]) + 1)->expr_count = 0;
-			(yyval) = list_create((yyvsp[(1) - (4)]));
+  case 162: /* direct_func_call: FUNC_CALL '(' opt_expression_list r_paren  */
+#line 1653 "awkgram.y"
+          {
+		param_sanity(yyvsp[-1]);
+		yyvsp[-3]->opcode = Op_func_call;
+		yyvsp[-3]->func_body = NULL;
+		if (yyvsp[-1] == NULL) {	/* no argument or error */
+			(yyvsp[-3] + 1)->expr_count = 0;
+			yyval = list_create(yyvsp[-3]);
 		} else {
-			INSTRUCTION *t = (yyvsp[(3) - (4)]);
-			((yyvsp[(1) - (4)]) + 1)->expr_count = count_expressions(&t, true); 
-			(yyval) = list_append(t, (yyvsp[(1) - (4)]));
+			INSTRUCTION *t = yyvsp[-1];
+			(yyvsp[-3] + 1)->expr_count = count_expressions(&t, true); 
+			yyval = list_append(t, yyvsp[-3]);
 		}
 	  }
+#line 3765 "awkgram.c"
     break;
 
-  case 163:
-/* Line 1778 of yacc.c  */
-#line 1637 "awkgram.y"
-    { (yyval) = NULL; }
+  case 163: /* opt_variable: %empty  */
+#line 1670 "awkgram.y"
+          { yyval = NULL; }
+#line 3771 "awkgram.c"
     break;
 
-  case 164:
-/* Line 1778 of yacc.c  */
-#line 1639 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); }
+  case 164: /* opt_variable: variable  */
+#line 1672 "awkgram.y"
+          { yyval = yyvsp[0]; }
+#line 3777 "awkgram.c"
     break;
 
-  case 165:
-/* Line 1778 of yacc.c  */
-#line 1644 "awkgram.y"
-    { (yyval) = NULL; }
+  case 165: /* delete_subscript_list: %empty  */
+#line 1677 "awkgram.y"
+          { yyval = NULL; }
+#line 3783 "awkgram.c"
     break;
 
-  case 166:
-/* Line 1778 of yacc.c  */
-#line 1646 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (2)]); }
+  case 166: /* delete_subscript_list: delete_subscript SUBSCRIPT  */
+#line 1679 "awkgram.y"
+          { yyval = yyvsp[-1]; }
+#line 3789 "awkgram.c"
     break;
 
-  case 167:
-/* Line 1778 of yacc.c  */
-#line 1651 "awkgram.y"
-    {	(yyval) = (yyvsp[(1) - (1)]); }
+  case 167: /* delete_subscript: delete_exp_list  */
+#line 1684 "awkgram.y"
+          {	yyval = yyvsp[0]; }
+#line 3795 "awkgram.c"
     break;
 
-  case 168:
-/* Line 1778 of yacc.c  */
-#line 1653 "awkgram.y"
-    {
-		(yyval) = list_merge((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)]));
+  case 168: /* delete_subscript: delete_subscript delete_exp_list  */
+#line 1686 "awkgram.y"
+          {
+		yyval = list_merge(yyvsp[-1], yyvsp[0]);
 	  }
+#line 3803 "awkgram.c"
     break;
 
-  case 169:
-/* Line 1778 of yacc.c  */
-#line 1660 "awkgram.y"
-    {
-		INSTRUCTION *ip = (yyvsp[(1) - (1)])->lasti; 
+  case 169: /* delete_exp_list: bracketed_exp_list  */
+#line 1693 "awkgram.y"
+          {
+		INSTRUCTION *ip = yyvsp[0]->lasti; 
 		int count = ip->sub_count;	/* # of SUBSEP-seperated expressions */
 		if (count > 1) {
 			/* change Op_subscript or Op_sub_array to Op_concat */
@@ -3937,152 +3813,162 @@ regular_print:
 		} else
 			ip->opcode = Op_no_op;
 		sub_counter++;	/* count # of dimensions */
-		(yyval) = (yyvsp[(1) - (1)]);
+		yyval = yyvsp[0];
 	  }
+#line 3821 "awkgram.c"
     break;
 
-  case 170:
-/* Line 1778 of yacc.c  */
-#line 1677 "awkgram.y"
-    {
-		INSTRUCTION *t = (yyvsp[(2) - (3)]);
-		if ((yyvsp[(2) - (3)]) == NULL) {
-			error_ln((yyvsp[(3) - (3)])->source_line,
+  case 170: /* bracketed_exp_list: '[' expression_list ']'  */
+#line 1710 "awkgram.y"
+          {
+		INSTRUCTION *t = yyvsp[-1];
+		if (yyvsp[-1] == NULL) {
+			error_ln(yyvsp[0]->source_line,
 				_("invalid subscript expression"));
 			/* install Null string as subscript. */
 			t = list_create(instruction(Op_push_i));
 			t->nexti->memory = dupnode(Nnull_string);
-			(yyvsp[(3) - (3)])->sub_count = 1;			
+			yyvsp[0]->sub_count = 1;			
 		} else
-			(yyvsp[(3) - (3)])->sub_count = count_expressions(&t, false);
-		(yyval) = list_append(t, (yyvsp[(3) - (3)]));
+			yyvsp[0]->sub_count = count_expressions(&t, false);
+		yyval = list_append(t, yyvsp[0]);
 	  }
+#line 3839 "awkgram.c"
     break;
 
-  case 171:
-/* Line 1778 of yacc.c  */
-#line 1694 "awkgram.y"
-    {	(yyval) = (yyvsp[(1) - (1)]); }
+  case 171: /* subscript: bracketed_exp_list  */
+#line 1727 "awkgram.y"
+          {	yyval = yyvsp[0]; }
+#line 3845 "awkgram.c"
     break;
 
-  case 172:
-/* Line 1778 of yacc.c  */
-#line 1696 "awkgram.y"
-    {
-		(yyval) = list_merge((yyvsp[(1) - (2)]), (yyvsp[(2) - (2)]));
+  case 172: /* subscript: subscript bracketed_exp_list  */
+#line 1729 "awkgram.y"
+          {
+		yyval = list_merge(yyvsp[-1], yyvsp[0]);
 	  }
+#line 3853 "awkgram.c"
     break;
 
-  case 173:
-/* Line 1778 of yacc.c  */
-#line 1703 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (2)]); }
+  case 173: /* subscript_list: subscript SUBSCRIPT  */
+#line 1736 "awkgram.y"
+          { yyval = yyvsp[-1]; }
+#line 3859 "awkgram.c"
     break;
 
-  case 174:
-/* Line 1778 of yacc.c  */
-#line 1708 "awkgram.y"
-    {
-		char *var_name = (yyvsp[(1) - (1)])->lextok;
+  case 174: /* simple_variable: NAME  */
+#line 1741 "awkgram.y"
+          {
+		char *var_name = yyvsp[0]->lextok;
 
-		(yyvsp[(1) - (1)])->opcode = Op_push;
-		(yyvsp[(1) - (1)])->memory = variable((yyvsp[(1) - (1)])->source_line, var_name, Node_var_new);
-		(yyval) = list_create((yyvsp[(1) - (1)]));
+		yyvsp[0]->opcode = Op_push;
+		yyvsp[0]->memory = variable(yyvsp[0]->source_line, var_name, Node_var_new);
+		yyval = list_create(yyvsp[0]);
 	  }
+#line 3871 "awkgram.c"
     break;
 
-  case 175:
-/* Line 1778 of yacc.c  */
-#line 1716 "awkgram.y"
-    {
-		char *arr = (yyvsp[(1) - (2)])->lextok;
-		(yyvsp[(1) - (2)])->memory = variable((yyvsp[(1) - (2)])->source_line, arr, Node_var_new);
-		(yyvsp[(1) - (2)])->opcode = Op_push_array;
-		(yyval) = list_prepend((yyvsp[(2) - (2)]), (yyvsp[(1) - (2)]));
+  case 175: /* simple_variable: NAME subscript_list  */
+#line 1749 "awkgram.y"
+          {
+		char *arr = yyvsp[-1]->lextok;
+		yyvsp[-1]->memory = variable(yyvsp[-1]->source_line, arr, Node_var_new);
+		yyvsp[-1]->opcode = Op_push_array;
+		yyval = list_prepend(yyvsp[0], yyvsp[-1]);
 	  }
+#line 3882 "awkgram.c"
     break;
 
-  case 176:
-/* Line 1778 of yacc.c  */
-#line 1726 "awkgram.y"
-    {
-		INSTRUCTION *ip = (yyvsp[(1) - (1)])->nexti;
+  case 176: /* variable: simple_variable  */
+#line 1759 "awkgram.y"
+          {
+		INSTRUCTION *ip = yyvsp[0]->nexti;
 		if (ip->opcode == Op_push
 			&& ip->memory->type == Node_var
 			&& ip->memory->var_update
 		) {
-			(yyval) = list_prepend((yyvsp[(1) - (1)]), instruction(Op_var_update));
-			(yyval)->nexti->update_var = ip->memory->var_update;
+			yyval = list_prepend(yyvsp[0], instruction(Op_var_update));
+			yyval->nexti->update_var = ip->memory->var_update;
 		} else
-			(yyval) = (yyvsp[(1) - (1)]);
+			yyval = yyvsp[0];
 	  }
+#line 3898 "awkgram.c"
     break;
 
-  case 177:
-/* Line 1778 of yacc.c  */
-#line 1738 "awkgram.y"
-    {
-		(yyval) = list_append((yyvsp[(2) - (3)]), (yyvsp[(1) - (3)]));
-		if ((yyvsp[(3) - (3)]) != NULL)
-			mk_assignment((yyvsp[(2) - (3)]), NULL, (yyvsp[(3) - (3)]));
+  case 177: /* variable: '$' non_post_simp_exp opt_incdec  */
+#line 1771 "awkgram.y"
+          {
+		/* note the highest constant field number, see count_NF() */
+		if (yyvsp[-1]->nexti == yyvsp[-1]->lasti && yyvsp[-1]->lasti->opcode == Op_push_i
+				&& (yyvsp[-1]->lasti->memory->flags & NUMBER) != 0) {
+			long fnum = get_number_si(yyvsp[-1]->lasti->memory);
+
+			if (fnum > max_field_ref)
+				max_field_ref = fnum;
+		} else
+			dyn_field_ref = true;
+		yyval = list_append(yyvsp[-1], yyvsp[-2]);
+		if (yyvsp[0] != NULL)
+			mk_assignment(yyvsp[-1], NULL, yyvsp[0]);
 	  }
+#line 3917 "awkgram.c"
     break;
 
-  case 178:
-/* Line 1778 of yacc.c  */
-#line 1747 "awkgram.y"
-    {
-		(yyvsp[(1) - (1)])->opcode = Op_postincrement;
+  case 178: /* opt_incdec: INCREMENT  */
+#line 1789 "awkgram.y"
+          {
+		yyvsp[0]->opcode = Op_postincrement;
 	  }
+#line 3925 "awkgram.c"
     break;
 
-  case 179:
-/* Line 1778 of yacc.c  */
-#line 1751 "awkgram.y"
-    {
-		(yyvsp[(1) - (1)])->opcode = Op_postdecrement;
+  case 179: /* opt_incdec: DECREMENT  */
+#line 1793 "awkgram.y"
+          {
+		yyvsp[0]->opcode = Op_postdecrement;
 	  }
+#line 3933 "awkgram.c"
     break;
 
-  case 180:
-/* Line 1778 of yacc.c  */
-#line 1754 "awkgram.y"
-    { (yyval) = NULL; }
+  case 180: /* opt_incdec: %empty  */
+#line 1796 "awkgram.y"
+                        { yyval = NULL; }
+#line 3939 "awkgram.c"
     break;
 
-  case 182:
-/* Line 1778 of yacc.c  */
-#line 1762 "awkgram.y"
-    { yyerrok; }
+  case 182: /* r_brace: '}' opt_nls  */
+#line 1804 "awkgram.y"
+                        { yyerrok; }
+#line 3945 "awkgram.c"
     break;
 
-  case 183:
-/* Line 1778 of yacc.c  */
-#line 1766 "awkgram.y"
-    { yyerrok; }
+  case 183: /* r_paren: ')'  */
+#line 1808 "awkgram.y"
+              { yyerrok; }
+#line 3951 "awkgram.c"
     break;
 
-  case 186:
-/* Line 1778 of yacc.c  */
-#line 1775 "awkgram.y"
-    { yyerrok; }
+  case 186: /* semi: ';'  */
+#line 1817 "awkgram.y"
+                { yyerrok; }
+#line 3957 "awkgram.c"
     break;
 
-  case 187:
-/* Line 1778 of yacc.c  */
-#line 1779 "awkgram.y"
-    { (yyval) = (yyvsp[(1) - (1)]); yyerrok; }
+  case 187: /* colon: ':'  */
+#line 1821 "awkgram.y"
+                { yyval = yyvsp[0]; yyerrok; }
+#line 3963 "awkgram.c"
     break;
 
-  case 188:
-/* Line 1778 of yacc.c  */
-#line 1783 "awkgram.y"
-    { yyerrok; }
+  case 188: /* comma: ',' opt_nls  */
+#line 1825 "awkgram.y"
+                        { yyerrok; }
+#line 3969 "awkgram.c"
     break;
 
 
-/* Line 1778 of yacc.c  */
-#line 4098 "awkgram.c"
+#line 3973 "awkgram.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4096,96 +3982,58 @@ regular_print:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
-	 error, discard it.  */
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
   /* Else will try to reuse lookahead token after shifting the error
@@ -4197,14 +4045,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -4217,29 +4064,30 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4251,7 +4099,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4262,26 +4110,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -4290,31 +4142,25 @@ yyreturn:
       yydestruct ("Cleanup: discarding lookahead",
                   yytoken, &yylval);
     }
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
 
+  return yyresult;
+}
 
-/* Line 2041 of yacc.c  */
-#line 1785 "awkgram.y"
+#line 1827 "awkgram.y"
 
 
 struct token {
@@ -4814,6 +4660,8 @@ parse_program(INSTRUCTION **pcode)
 	sourceline = 0;
 	if (ret == 0)	/* avoid spurious warning if parser aborted with YYABORT */
 		check_funcs();
+	if (ret == 0 && errcount == 0 && in_main_context())
+		inline_calls(*pcode);
 
 	if (args_array == NULL)
 		emalloc(args_array, NODE **, (max_args + 2) * sizeof(NODE *), "parse_program");
@@ -6052,7 +5900,7 @@ retry:
 			d = nondec2awknum(tokstart, strlen(tokstart));
 		else
 			d = atof(tokstart);
-		yylval->memory = make_number(d);
+		yylval->memory = make_unshared_number(d);
 		if (d <= INT32_MAX && d >= INT32_MIN && d == (int32_t) d)
 			yylval->memory->flags |= NUMINT;
 		return lasttok = YNUMBER;
@@ -6292,6 +6140,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 		r->sub_flags = 0;
 
 		arg = subn->nexti;		/* first arg list */
+		const_regexp(arg);
 		(void) mk_rexp(arg);
 
 		if (strcmp(operator, "gensub") != 0) {
@@ -6305,7 +6154,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				INSTRUCTION *expr;
 
 				expr = list_create(instruction(Op_push_i));
-				expr->nexti->memory = make_number(0.0);
+				expr->nexti->memory = make_unshared_number(0.0);
 				(void) mk_expression_list(subn,
 						list_append(expr, instruction(Op_field_spec)));
 			}
@@ -6349,7 +6198,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 			r->sub_flags |= GENSUB;
 			if (nexp == 3) {
 				ip = instruction(Op_push_i);
-				ip->memory = make_number(0.0);
+				ip->memory = make_unshared_number(0.0);
 				(void) mk_expression_list(subn,
 						list_append(list_create(ip), instruction(Op_field_spec)));
 			}
@@ -6367,6 +6216,9 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 #endif
 		r->builtin = tokentab[idx].ptr;
 
+	if (subn != NULL && (ip = fold_builtin(subn, r, nexp)) != NULL)
+		return ip;
+
 	/* special case processing for a few builtins */
 
 	if (r->builtin == do_length) {
@@ -6378,7 +6230,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 			list = list_create(r);
 			(void) list_prepend(list, instruction(Op_field_spec));
 			(void) list_prepend(list, instruction(Op_push_i));
-			list->nexti->memory = make_number(0.0);
+			list->nexti->memory = make_unshared_number(0.0);
 			return list; 
 		} else {
 			arg = subn->nexti;
@@ -6393,6 +6245,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 		static bool warned = false;
 
 		arg = subn->nexti->lasti->nexti;	/* 2nd arg list */
+		const_regexp(arg);
 		(void) mk_rexp(arg);
 
 		if (nexp == 3) {	/* 3rd argument there */
@@ -6500,20 +6353,169 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				ip->opcode = Op_push_array;
 		}
 	}
-#ifdef ARRAYDEBUG
-	else if (r->builtin == do_adump) {
-		ip = subn->nexti->lasti;
-		if (ip->opcode == Op_push)
-			ip->opcode = Op_push_array;
+#ifdef ARRAYDEBUG
+	else if (r->builtin == do_adump) {
+		ip = subn->nexti->lasti;
+		if (ip->opcode == Op_push)
+			ip->opcode = Op_push_array;
+	}
+#endif
+
+	if (subn != NULL) {
+		r->expr_count = count_expressions(&subn, false);
+		return list_append(subn, r);
+	}
+
+	r->expr_count = 0;
+	return list_create(r);
+}
+
+
+#define FOLD_MAX_ARGS	8	/* most arguments of a builtin folded at parse time */
+
+/* fold_sprintf_ok --- check that sprintf(fmt, args) can be done at parse time */
+
+static bool
+fold_sprintf_ok(NODE *fmt, NODE **args, int nargs)
+{
+	const char *cp = fmt->stptr;
+	const char *end = cp + fmt->stlen;
+	int cur = 0;
+	int ndigits;
+
+	/*
+	 * Only plain conversions with literal widths and precisions; `*',
+	 * positional arguments and the thousands grouping flag are all
+	 * left for run time.
+	 */
+	while (cp < end) {
+		if (*cp++ != '%')
+			continue;
+		if (cp < end && *cp == '%') {
+			cp++;
+			continue;
+		}
+		while (cp < end && strchr("-+ #0", *cp) != NULL)
+			cp++;
+		for (ndigits = 0; cp < end && isdigit((unsigned char) *cp); ndigits++)
+			cp++;
+		if (cp < end && *cp == '.') {
+			cp++;
+			while (cp < end && isdigit((unsigned char) *cp)) {
+				cp++;
+				ndigits++;
+			}
+		}
+		if (cp >= end || ndigits > 4 || ++cur >= nargs)
+			return false;
+
+		switch (*cp++) {
+		case 'c':
+		case 's':
+			/* a number's string value may depend on CONVFMT */
+			if ((args[cur]->flags & STRING) == 0)
+				return false;
+			break;
+		case 'd':
+		case 'i':
+		case 'o':
+		case 'u':
+		case 'x':
+		case 'X':
+		case 'e':
+		case 'E':
+		case 'f':
+		case 'F':
+		case 'g':
+		case 'G':
+			if ((args[cur]->flags & STRING) != 0)
+				return false;
+			break;
+		default:
+			return false;
+		}
+	}
+	return (cur == nargs - 1);
+}
+
+/* fold_builtin --- evaluate length, substr or sprintf of constants */
+
+static INSTRUCTION *
+fold_builtin(INSTRUCTION *subn, INSTRUCTION *r, int nexp)
+{
+	NODE *args[FOLD_MAX_ARGS];
+	NODE *res = NULL;
+	INSTRUCTION *arg, *next;
+	size_t i;
+
+	if (do_optimize < 2 || do_pretty_print || do_lint || do_mpfr
+			|| nexp > FOLD_MAX_ARGS)
+		return NULL;
+
+	nexp = 0;
+	for (arg = subn->nexti; arg != NULL; arg = arg->lasti->nexti) {
+		if (arg->nexti != arg->lasti || arg->nexti->opcode != Op_push_i
+				|| (arg->nexti->memory->flags & INTLSTR) != 0)
+			return NULL;
+		args[nexp++] = arg->nexti->memory;
 	}
-#endif
 
-	if (subn != NULL) {
-		r->expr_count = count_expressions(&subn, false);
-		return list_append(subn, r);
+	if (r->builtin == do_length || r->builtin == do_substr) {
+		NODE *s = args[0];
+		size_t len, indx;
+		double d_index, d_length = 0;
+
+		/* keep to strings whose length in characters is their length in bytes */
+		if ((s->flags & STRING) == 0)
+			return NULL;
+		if (gawk_mb_cur_max > 1) {
+			for (i = 0; i < s->stlen; i++)
+				if ((unsigned char) s->stptr[i] >= 0x80)
+					return NULL;
+		}
+		len = s->stlen;
+
+		if (r->builtin == do_length)
+			res = make_unshared_number((AWKNUM) len);
+		else {
+			/* same rules as do_substr() */
+			if (((args[1]->flags | (nexp == 3 ? args[2]->flags : 0)) & STRING) != 0)
+				return NULL;
+			d_index = args[1]->numbr;
+			if (nexp == 3)
+				d_length = args[2]->numbr;
+
+			if (! (d_index >= 1))
+				d_index = 1;
+			if ((nexp == 3 && ! (d_length >= 1)) || d_index - 1 >= len)
+				res = dupnode(Nnull_string);
+			else {
+				indx = d_index - 1;
+				if (nexp == 2 || d_length > len - indx)
+					d_length = len - indx;
+				res = make_string(s->stptr + indx, (size_t) d_length);
+			}
+		}
+	} else if (r->builtin == do_sprintf) {
+		/* the program is parsed with LC_NUMERIC set to "C" */
+		if (use_lc_numeric || (args[0]->flags & STRING) == 0
+				|| ! fold_sprintf_ok(args[0], args, nexp))
+			return NULL;
+		res = format_tree(args[0]->stptr, args[0]->stlen, args, nexp);
 	}
 
-	r->expr_count = 0;
+	if (res == NULL)
+		return NULL;
+
+	for (arg = subn->nexti; arg != NULL; arg = next) {
+		next = arg->lasti->nexti;
+		unref(arg->nexti->memory);
+		bcfree(arg->nexti);
+		bcfree(arg);
+	}
+	bcfree(subn);
+	r->opcode = Op_push_i;
+	r->memory = res;
 	return list_create(r);
 }
 
@@ -6689,6 +6691,8 @@ mk_function(INSTRUCTION *fi, INSTRUCTION *def)
 	if (do_pretty_print)
 		(void) list_prepend(def, instruction(Op_exec_count));
 
+	fuse_field_refs(def);
+
 	/* fi->opcode = Op_func */
 	(fi + 1)->firsti = def->nexti;
 	(fi + 1)->lasti = def->lasti;
@@ -7044,6 +7048,37 @@ mk_rexp(INSTRUCTION *list)
 	return ip->memory;
 }
 
+/* const_regexp --- compile a constant string used as a regexp at parse time */
+
+static void
+const_regexp(INSTRUCTION *list)
+{
+	INSTRUCTION *ip = list->nexti;
+	NODE *n, *re;
+	size_t i;
+
+	if (do_optimize < 2 || do_pretty_print
+			|| ip != list->lasti || ip->opcode != Op_push_i)
+		return;
+
+	n = ip->memory;
+	if ((n->flags & (STRING|INTLSTR)) != STRING)
+		return;
+
+	/*
+	 * A bad dynamic regexp is a fatal error at run time, not a syntax
+	 * error, so only take text that is sure to compile.
+	 */
+	for (i = 0; i < n->stlen; i++)
+		if (n->stptr[i] == '\0' || strchr("\\()[]{}*+?", n->stptr[i]) != NULL)
+			return;
+
+	if ((re = make_regnode(Node_regex, n)) == NULL)
+		return;
+	ip->opcode = Op_match_rec;
+	ip->memory = re;
+}
+
 /* isnoeffect --- when used as a statement, has no side effects */
 
 static int
@@ -7066,10 +7101,13 @@ isnoeffect(OPCODE type)
 	case Op_exp_i:
 	case Op_unary_minus:
 	case Op_field_spec:
+	case Op_field_spec_i:
 	case Op_and_final:
 	case Op_or_final:
 	case Op_equal:
+	case Op_equal_i:
 	case Op_notequal:
+	case Op_notequal_i:
 	case Op_less:
 	case Op_greater:
 	case Op_leq:
@@ -7190,20 +7228,14 @@ mk_binary(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op)
 				res *= n2->numbr;
 				break;
 			case Op_quotient:
-				if (n2->numbr == 0.0) {
-					/* don't fatalize, allow parsing rest of the input */
-					error_ln(op->source_line, _("division by zero attempted"));
-					goto regular;
-				}
+				if (n2->numbr == 0.0)
+					goto regular;	/* fatal at run time, if reached */
 
 				res /= n2->numbr;
 				break;
 			case Op_mod:
-				if (n2->numbr == 0.0) {
-					/* don't fatalize, allow parsing rest of the input */
-					error_ln(op->source_line, _("division by zero attempted in `%%'"));
-					goto regular;
-				}
+				if (n2->numbr == 0.0)
+					goto regular;	/* fatal at run time, if reached */
 #ifdef HAVE_FMOD
 				res = fmod(res, n2->numbr);
 #else	/* ! HAVE_FMOD */
@@ -7225,7 +7257,7 @@ mk_binary(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op)
 			}
 
 			op->opcode = Op_push_i;
-			op->memory = make_number(res);
+			op->memory = make_unshared_number(res);
 			unref(n1);
 			unref(n2);
 			bcfree(ip1);
@@ -7272,6 +7304,63 @@ regular:
 	return list_append(s1, op);
 }
 
+/* fold_relop --- fold a comparison of two numeric constants into s1 */
+
+static bool
+fold_relop(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op)
+{
+	INSTRUCTION *ip1 = s1->nexti, *ip2 = s2->nexti;
+	NODE *n1, *n2;
+	int di;
+	bool res;
+
+	/*
+	 * String comparisons are left alone: they depend on IGNORECASE
+	 * and the locale, which can change at run time.
+	 */
+	if (do_optimize < 2 || do_pretty_print
+			|| ip1 != s1->lasti || ip1->opcode != Op_push_i
+			|| ip2 != s2->lasti || ip2->opcode != Op_push_i
+			|| (ip1->memory->flags & (MPFN|MPZN|STRCUR|STRING)) != 0
+			|| (ip2->memory->flags & (MPFN|MPZN|STRCUR|STRING)) != 0)
+		return false;
+
+	n1 = ip1->memory;
+	n2 = ip2->memory;
+	di = cmp_nodes(n1, n2);
+
+	switch (op->opcode) {
+	case Op_equal:
+		res = (di == 0);
+		break;
+	case Op_notequal:
+		res = (di != 0);
+		break;
+	case Op_less:
+		res = (di < 0);
+		break;
+	case Op_greater:
+		res = (di > 0);
+		break;
+	case Op_leq:
+		res = (di <= 0);
+		break;
+	case Op_geq:
+		res = (di >= 0);
+		break;
+	default:
+		return false;
+	}
+
+	ip1->memory = make_unshared_number((AWKNUM) res);
+	unref(n1);
+	unref(n2);
+	bcfree(ip2);
+	bcfree(s2);
+	bcfree(op);
+	return true;
+}
+
 /* mk_boolean --- instructions for boolean and, or */
  
 static INSTRUCTION *
@@ -7322,6 +7411,27 @@ mk_boolean(INSTRUCTION *left, INSTRUCTION *right, INSTRUCTION *op)
 	return list_merge(left, right);
 }
 
+/* ends_flow --- true if control never falls off the end of a statement list */
+
+static bool
+ends_flow(INSTRUCTION *list)
+{
+	if (do_optimize < 2 || do_pretty_print || do_debug)
+		return false;
+
+	switch (list->lasti->opcode) {
+	case Op_K_exit:
+	case Op_K_next:
+	case Op_K_nextfile:
+	case Op_K_return:
+	case Op_K_break:
+	case Op_K_continue:
+		return true;
+	default:
+		return false;
+	}
+}
+
 /* mk_condition --- if-else and conditional */
 
 static INSTRUCTION *
@@ -7348,6 +7458,28 @@ mk_condition(INSTRUCTION *cond, INSTRUCTION *ifp, INSTRUCTION *true_branch,
 
 	INSTRUCTION *ip;
 
+	/* a constant condition keeps only the branch it selects */
+	if (do_optimize > 1 && ! do_pretty_print && ! do_debug
+			&& cond->nexti == cond->lasti && cond->nexti->opcode == Op_push_i
+			&& (cond->nexti->memory->flags & (MPFN|MPZN|INTLSTR)) == 0
+	) {
+		NODE *n = cond->nexti->memory;
+		bool taken;
+
+		if ((n->flags & STRING) != 0)
+			taken = (n->stlen != 0);
+		else
+			taken = (n->numbr != 0.0);
+
+		unref(n);
+		bcfree(cond->nexti);
+		bcfree(cond);
+		bcfree(ifp);
+		if (elsep != NULL)
+			bcfree(elsep);
+		return taken ? true_branch : false_branch;
+	}
+
 	if (false_branch == NULL) {
 		false_branch = list_create(instruction(Op_no_op));
 		if (elsep != NULL) {		/* else { } */
@@ -7492,6 +7624,8 @@ append_rule(INSTRUCTION *pattern, INSTRUCTION *action)
 
 	list_append(rule_list, rp + 1);
 
+	fuse_field_refs(ip);
+
 	if (rule_block[rule] == NULL)
 		rule_block[rule] = ip;
 	else
@@ -7586,6 +7720,10 @@ optimize_assignment(INSTRUCTION *exp)
 	 * onto the runtime stack.
 	 */
 
+	fuse_field_refs(exp);
+	if ((i1 = optimize_plus_assign(exp)) != NULL)
+		return i1;
+
 	i2 = NULL;
 	i1 = exp->lasti;
 
@@ -7711,6 +7849,491 @@ optimize_assignment(INSTRUCTION *exp)
 }
 
 
+/*
+ * optimize_plus_assign --- superinstructions for adding to a variable or
+ * an array element in a statement of its own.
+ *
+ *   Replaces Op_push_lhs + Op_assign_plus + Op_pop (var += x), and
+ *   Op_push_lhs + Op_postincrement + Op_pop (var++, and likewise for
+ *   the other increment and decrement operators) with Op_store_plus.
+ *
+ *   Replaces Op_push_array + Op_subscript_lhs + Op_assign_plus + Op_pop
+ *   (array[sub] += x) and the array[sub]++ equivalents with
+ *   Op_store_sub_plus.  Like Op_store_sub, only for one dimension and a
+ *   subscript that is a single instruction.
+ *
+ * A constant increment is kept in initval.  Returns NULL if exp isn't
+ * one of these.
+ */
+
+static INSTRUCTION *
+optimize_plus_assign(INSTRUCTION *exp)
+{
+	INSTRUCTION *i1, *i2, *i3, *prev;
+	AWKNUM incr;
+
+	/* MPFR does its arithmetic in mpg_interpret(), which doesn't know these */
+	if (! do_optimize || do_pretty_print || do_mpfr)
+		return NULL;
+
+	i1 = exp->lasti;
+	switch (i1->opcode) {
+	case Op_preincrement:
+	case Op_postincrement:
+		incr = 1.0;
+		break;
+	case Op_predecrement:
+	case Op_postdecrement:
+		incr = -1.0;
+		break;
+	case Op_assign_plus:
+		incr = 0.0;
+		break;
+	default:
+		return NULL;
+	}
+
+	/* find the instruction before the operator, and the one before that */
+	prev = i2 = NULL;
+	for (i3 = exp->nexti; i3->nexti != i1; i3 = i3->nexti) {
+		prev = i2;
+		i2 = i3;
+	}
+	/* now i3 is just before i1, i2 before i3 and prev before i2 */
+
+	if (i3->opcode == Op_push_lhs) {
+		/* var += .. */
+		i3->opcode = Op_store_plus;
+	} else if (i3->opcode == Op_subscript_lhs
+			&& i3->sub_count == 1
+			&& (i2->opcode == Op_push
+				|| i2->opcode == Op_push_i
+				|| i2->opcode == Op_field_spec_i)
+			&& prev != NULL
+			&& prev->opcode == Op_push_array
+			&& prev->memory != symbol_table
+			&& prev->memory != func_table
+	) {
+		/* array[sub] += .. */
+		i3->opcode = Op_store_sub_plus;
+		i3->memory = prev->memory;
+
+		/* remove Op_push_array */
+		if (exp->nexti == prev)
+			exp->nexti = i2;
+		else {
+			INSTRUCTION *t;
+
+			for (t = exp->nexti; t->nexti != prev; t = t->nexti)
+				;
+			t->nexti = i2;
+		}
+		bcfree(prev);
+	} else
+		return NULL;
+
+	i3->initval = NULL;
+	if (incr != 0.0)
+		i3->initval = make_unshared_number(incr);
+	else if (exp->nexti->opcode == Op_push_i
+			&& exp->nexti->nexti == i3
+			&& (exp->nexti->memory->flags & (NUMBER|NUMCUR)) == (NUMBER|NUMCUR)
+	) {
+		/* constant increment, var += 2 */
+		i2 = exp->nexti;
+		i3->initval = i2->memory;
+		exp->nexti = i3;
+		bcfree(i2);
+	}
+
+	i3->nexti = NULL;
+	bcfree(i1);		/* the operator */
+	exp->lasti = i3;	/* update Op_list */
+	return exp;
+}
+
+/*
+ * fuse_field_refs --- peephole pass over a finished rule or function
+ * body, or an expression statement.  Replaces Op_push_i + Op_field_spec
+ * ($n for a constant n) with a single Op_field_spec_i.
+ *
+ * Op_field_spec is never a jump target, and $n is only fused where it
+ * is no longer needed as an lvalue, so nothing can point at the
+ * instruction that goes away.
+ */
+
+static void
+fuse_field_refs(INSTRUCTION *list)
+{
+	INSTRUCTION *ip, *fp;
+
+	if (! do_optimize || do_pretty_print)
+		return;
+
+	for (ip = list->nexti; ip != NULL && ip != list->lasti; ip = ip->nexti) {
+		fp = ip->nexti;
+		if (ip->opcode != Op_push_i || fp->opcode != Op_field_spec
+				|| (ip->memory->flags & (NUMBER|INTLSTR)) != NUMBER)
+			continue;
+		ip->opcode = Op_field_spec_i;
+		ip->nexti = fp->nexti;
+		if (list->lasti == fp)
+			list->lasti = ip;
+		bcfree(fp);
+	}
+}
+
+/*
+ * Inlining of small functions, with -O.
+ *
+ * A call to a function that is short, calls no other function, and uses
+ * its parameters and locals only as scalars is replaced by a copy of the
+ * function body:
+ *
+ *	[args] Op_func_call
+ * becomes
+ *	[args] Op_inline_enter [body] Op_inline_leave
+ *
+ * with each Op_K_return in the body turned into a jump to
+ * Op_inline_leave.  The parameters and locals become hidden variables,
+ * one set per function; as the body can't call anything, nothing can
+ * re-enter it while they are in use.  Op_inline_enter binds the argument
+ * values to them.  An argument that isn't a value (an untyped variable
+ * or an array, whose type the callee might change) makes it jump to an
+ * ordinary call instead.
+ *
+ * Not done when profiling, so that counts are still kept per function,
+ * nor for the debugger or lint.
+ */
+
+#define INLINE_MAX_SIZE	40	/* instructions in an inlined body */
+
+struct inline_func {
+	NODE *func;
+	NODE *vars;	/* hidden parameters and locals, NULL if not inlinable */
+};
+
+/* inline_in_body --- true if ip is one of the instructions first .. last */
+
+static bool
+inline_in_body(INSTRUCTION *ip, INSTRUCTION *first, INSTRUCTION *last)
+{
+	INSTRUCTION *t;
+
+	for (t = first; t != NULL; t = t->nexti) {
+		if (t == ip)
+			return true;
+		if (t == last)
+			break;
+	}
+	return false;
+}
+
+/* inline_ok --- check that function f can be inlined */
+
+static bool
+inline_ok(NODE *f)
+{
+	INSTRUCTION *first, *last, *ip;
+	int size = 0;
+
+	first = f->code_ptr->nexti;
+	last = (f->code_ptr + 1)->lasti;
+
+	for (ip = first; ; ip = ip->nexti) {
+		if (++size > INLINE_MAX_SIZE)
+			return false;
+
+		switch (ip->opcode) {
+		case Op_push:
+		case Op_push_arg:
+		case Op_push_lhs:
+		case Op_store_var:
+		case Op_store_plus:
+		case Op_assign_concat:
+			/* parameters are fine as scalars */
+			break;
+
+		case Op_push_array:
+		case Op_store_sub:
+		case Op_store_sub_plus:
+			if (ip->memory->type == Node_param_list)
+				return false;
+			break;
+
+		case Op_jmp:
+		case Op_jmp_true:
+		case Op_jmp_false:
+		case Op_and:
+		case Op_or:
+		case Op_K_break:
+		case Op_K_continue:
+			if (! inline_in_body(ip->target_jmp, first, last))
+				return false;
+			break;
+
+		case Op_field_spec_lhs:
+			if (ip->target_assign != NULL
+					&& ! inline_in_body(ip->target_assign, first, last))
+				return false;
+			break;
+
+		case Op_builtin:
+			/* these can call a user-defined comparison function */
+			if (ip->builtin == do_asort || ip->builtin == do_asorti)
+				return false;
+			break;
+
+		case Op_times:
+		case Op_times_i:
+		case Op_quotient:
+		case Op_quotient_i:
+		case Op_mod:
+		case Op_mod_i:
+		case Op_plus:
+		case Op_plus_i:
+		case Op_minus:
+		case Op_minus_i:
+		case Op_exp:
+		case Op_exp_i:
+		case Op_concat:
+		case Op_subscript:
+		case Op_sub_array:
+		case Op_preincrement:
+		case Op_predecrement:
+		case Op_postincrement:
+		case Op_postdecrement:
+		case Op_unary_minus:
+		case Op_field_spec:
+		case Op_field_spec_i:
+		case Op_not:
+		case Op_assign:
+		case Op_store_field:
+		case Op_assign_times:
+		case Op_assign_quotient:
+		case Op_assign_mod:
+		case Op_assign_plus:
+		case Op_assign_minus:
+		case Op_assign_exp:
+		case Op_and_final:
+		case Op_or_final:
+		case Op_equal:
+		case Op_equal_i:
+		case Op_notequal:
+		case Op_notequal_i:
+		case Op_less:
+		case Op_greater:
+		case Op_leq:
+		case Op_geq:
+		case Op_match:
+		case Op_match_rec:
+		case Op_nomatch:
+		case Op_K_print:
+		case Op_K_print_rec:
+		case Op_K_printf:
+		case Op_K_delete:
+		case Op_K_return:
+		case Op_sub_builtin:
+		case Op_in_array:
+		case Op_push_i:
+		case Op_push_re:
+		case Op_subscript_lhs:
+		case Op_no_op:
+		case Op_pop:
+		case Op_var_update:
+		case Op_var_assign:
+		case Op_field_assign:
+			break;
+
+		default:
+			/*
+			 * Calls, getline, next, exit, and for-in and switch,
+			 * which keep state on the stack.
+			 */
+			return false;
+		}
+
+		if (ip == last)
+			break;
+	}
+	return true;
+}
+
+/* make_inline_vars --- make the hidden variables for an inlinable function */
+
+static NODE *
+make_inline_vars(NODE *f)
+{
+	NODE *vars;
+	int i;
+
+	emalloc(vars, NODE *, (f->param_cnt + 1) * sizeof(NODE), "make_inline_vars");
+	memset(vars, 0, (f->param_cnt + 1) * sizeof(NODE));
+	for (i = 0; i < f->param_cnt; i++) {
+		vars[i].type = Node_var;
+		vars[i].vname = f->fparms[i].param;
+		vars[i].var_value = dupnode(Nnull_string);
+	}
+	return vars;
+}
+
+/* inline_call --- replace the call at pc with a copy of f's body */
+
+static void
+inline_call(INSTRUCTION *pc, NODE *f, NODE *vars)
+{
+	INSTRUCTION *old[INLINE_MAX_SIZE], *new[INLINE_MAX_SIZE];
+	INSTRUCTION *ip, *last, *leave, *call;
+	NODE *m;
+	int i, j, n;
+
+	last = (f->code_ptr + 1)->lasti;
+	n = 0;
+	for (ip = f->code_ptr->nexti; ; ip = ip->nexti) {
+		old[n] = ip;
+		new[n] = instruction(ip->opcode);
+		*new[n] = *ip;
+		n++;
+		if (ip == last)
+			break;
+	}
+
+	leave = instruction(Op_inline_leave);
+	leave->inline_vars = vars;
+	leave->expr_count = f->param_cnt;
+
+	for (i = 0; i < n; i++) {
+		ip = new[i];
+		ip->nexti = (i < n - 1) ? new[i + 1] : leave;
+
+		switch (ip->opcode) {
+		case Op_K_return:
+			ip->opcode = Op_jmp;
+			ip->target_jmp = leave;
+			break;
+
+		case Op_jmp:
+		case Op_jmp_true:
+		case Op_jmp_false:
+		case Op_and:
+		case Op_or:
+		case Op_K_break:
+		case Op_K_continue:
+			for (j = 0; old[j] != ip->target_jmp; j++)
+				;
+			ip->target_jmp = new[j];
+			break;
+
+		case Op_field_spec_lhs:
+			if (ip->target_assign != NULL) {
+				for (j = 0; old[j] != ip->target_assign; j++)
+					;
+				ip->target_assign = new[j];
+			}
+			break;
+
+		case Op_push:
+		case Op_push_arg:
+		case Op_push_lhs:
+		case Op_store_var:
+		case Op_store_plus:
+		case Op_assign_concat:
+			m = ip->memory;
+			if (m->type == Node_param_list)
+				ip->memory = & vars[m->param_cnt];
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	/* keep a real call for arguments Op_inline_enter can't bind */
+	call = bcalloc(Op_func_call, 2, pc->source_line);
+	memcpy(call, pc, 2 * sizeof(INSTRUCTION));
+	leave->nexti = pc->nexti;
+
+	pc->opcode = Op_inline_enter;
+	pc->inline_vars = vars;
+	pc->expr_count = (pc + 1)->expr_count;
+	(pc + 1)->expr_count = f->param_cnt;
+	(pc + 1)->target_call = call;
+	pc->nexti = new[0];
+}
+
+/* inline_list --- inline the calls in first .. last, written in source file src */
+
+static void
+inline_list(INSTRUCTION *first, INSTRUCTION *last, const char *src,
+		struct inline_func *funcs, size_t nfuncs)
+{
+	INSTRUCTION *pc;
+	NODE *f;
+	size_t i;
+
+	for (pc = first; pc != NULL; pc = pc->nexti) {
+		if (pc->opcode == Op_rule)
+			src = pc->source_file;
+		else if (pc->opcode == Op_func_call
+				&& (f = lookup(pc->func_name)) != NULL
+				&& f->type == Node_func
+				&& (pc + 1)->expr_count <= f->param_cnt
+				&& f->code_ptr->source_file == src
+		) {
+			for (i = 0; i < nfuncs && funcs[i].func != f; i++)
+				;
+			if (i < nfuncs && funcs[i].vars != NULL)
+				inline_call(pc, f, funcs[i].vars);
+		}
+		if (pc == last)
+			break;
+	}
+}
+
+/* inline_calls --- inline calls to small functions in the whole program */
+
+static void
+inline_calls(INSTRUCTION *code)
+{
+	NODE **list;
+	struct inline_func *funcs;
+	size_t i, nfuncs;
+	NODE *f;
+
+	if (do_optimize < 2 || do_debug || do_profile || do_pretty_print || do_lint)
+		return;
+
+	list = function_list(false);
+	for (nfuncs = 0; list[nfuncs] != NULL; nfuncs++)
+		;
+	if (nfuncs == 0) {
+		efree(list);
+		return;
+	}
+
+	/* decide before changing anything, inlining makes callers bigger */
+	emalloc(funcs, struct inline_func *, nfuncs * sizeof(struct inline_func), "inline_calls");
+	for (i = 0; i < nfuncs; i++) {
+		f = list[i];
+		funcs[i].func = f;
+		funcs[i].vars = NULL;
+		if (f->type == Node_func && inline_ok(f))
+			funcs[i].vars = make_inline_vars(f);
+	}
+
+	inline_list(code, NULL, NULL, funcs, nfuncs);
+	for (i = 0; i < nfuncs; i++) {
+		f = funcs[i].func;
+		if (f->type == Node_func)
+			inline_list(f->code_ptr->nexti, (f->code_ptr + 1)->lasti,
+					f->code_ptr->source_file, funcs, nfuncs);
+	}
+
+	efree(funcs);
+	efree(list);
+}
+
+
 /* mk_getline --- make instructions for getline */
 
 static INSTRUCTION *
@@ -68,12 +68,19 @@ static INSTRUCTION *mk_for_loop(INSTRUCTION *forp, INSTRUCTION *init, INSTRUCTIO
 		INSTRUCTION *incr, INSTRUCTION *body);
 static void fix_break_continue(INSTRUCTION *list, INSTRUCTION *b_target, INSTRUCTION *c_target);
 static INSTRUCTION *mk_binary(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op);
+static bool fold_relop(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op);
+static INSTRUCTION *fold_builtin(INSTRUCTION *subn, INSTRUCTION *r, int nexp);
+static void const_regexp(INSTRUCTION *list);
+static bool ends_flow(INSTRUCTION *list);
 static INSTRUCTION *mk_boolean(INSTRUCTION *left, INSTRUCTION *right, INSTRUCTION *op);
 static INSTRUCTION *mk_assignment(INSTRUCTION *lhs, INSTRUCTION *rhs, INSTRUCTION *op);
 static INSTRUCTION *mk_getline(INSTRUCTION *op, INSTRUCTION *opt_var, INSTRUCTION *redir, int redirtype);
 static NODE *make_regnode(int type, NODE *exp);
 static int count_expressions(INSTRUCTION **list, bool isarg);
 static INSTRUCTION *optimize_assignment(INSTRUCTION *exp);
+static INSTRUCTION *optimize_plus_assign(INSTRUCTION *exp);
+static void fuse_field_refs(INSTRUCTION *list);
+static void inline_calls(INSTRUCTION *code);
 static void add_lint(INSTRUCTION *list, LINTTYPE linttype);
 
 static void process_deferred();
@@ -447,6 +454,11 @@ statements
 			add_lint($2, LINT_no_effect);
 			if ($1 == NULL)
 				$$ = $2;
+			else if (ends_flow($1)) {
+				/* $2 can never be reached; drop it */
+				free_bc_list($2);
+				$$ = $1;
+			}
 			else
 				$$ = list_merge($1, $2);
 		}
@@ -1257,6 +1269,7 @@ exp
 			warning_ln($2->source_line,
 				_("regular expression on left of `~' or `!~' operator"));
 
+		const_regexp($3);
 		if ($3->lasti == $3->nexti && $3->nexti->opcode == Op_match_rec) {
 			$2->memory = $3->nexti->memory;
 			bcfree($3->nexti);	/* Op_match_rec */
@@ -1279,10 +1292,27 @@ exp
 	  }
 	| exp a_relop exp %prec RELOP
 	  {
+		INSTRUCTION *ip = $3->nexti;
+
 		if (do_lint && $3->lasti->opcode == Op_match_rec)
 			lintwarn_ln($2->source_line,
 				_("regular expression on right of comparison"));
-		$$ = list_append(list_merge($1, $3), $2);
+
+		if (fold_relop($1, $3, $2))
+			$$ = $1;
+		/* convert (Op_push_i Node_val) + (Op_equal) to (Op_equal_i Node_val) */
+		else if (do_optimize && ! do_pretty_print
+				&& ($2->opcode == Op_equal || $2->opcode == Op_notequal)
+				&& ip == $3->lasti && ip->opcode == Op_push_i
+				&& (ip->memory->flags & INTLSTR) == 0
+		) {
+			$2->opcode = ($2->opcode == Op_equal ? Op_equal_i : Op_notequal_i);
+			$2->memory = ip->memory;
+			bcfree(ip);
+			bcfree($3);	/* Op_list */
+			$$ = list_append($1, $2);
+		} else
+			$$ = list_append(list_merge($1, $3), $2);
 	  }
 	| exp '?' exp ':' exp
 	  { $$ = mk_condition($1, $2, $3, $4, $5); }
@@ -1339,9 +1369,12 @@ common_exp
 		 			                             */
 		}
 
-		if (do_optimize > 1
+		if (do_optimize > 1 && ! do_pretty_print
 			&& $1->nexti == $1->lasti && $1->nexti->opcode == Op_push_i
 			&& $2->nexti == $2->lasti && $2->nexti->opcode == Op_push_i
+			/* a number's string value depends on CONVFMT at run time */
+			&& ($1->nexti->memory->flags & STRING) != 0
+			&& ($2->nexti->memory->flags & STRING) != 0
 		) {
 			NODE *n1 = $1->nexti->memory;
 			NODE *n2 = $2->nexti->memory;
@@ -1473,7 +1506,7 @@ non_post_simp_exp
 		if ($2->opcode == Op_match_rec) {
 			$2->opcode = Op_nomatch;
 			$1->opcode = Op_push_i;
-			$1->memory = make_number(0.0);	
+			$1->memory = make_unshared_number(0.0);	
 			$$ = list_append(list_append(list_create($1),
 						instruction(Op_field_spec)), $2);
 		} else {
@@ -1569,7 +1602,7 @@ non_post_simp_exp
 	     * POSIX semantics: force a conversion to numeric type
 	     */
 		$1->opcode = Op_plus_i;
-		$1->memory = make_number(0.0);
+		$1->memory = make_unshared_number(0.0);
 		$$ = list_append($2, $1);
 	  }
 	;
@@ -1736,6 +1769,15 @@ variable
 	  }
 	| '$' non_post_simp_exp opt_incdec
 	  {
+		/* note the highest constant field number, see count_NF() */
+		if ($2->nexti == $2->lasti && $2->lasti->opcode == Op_push_i
+				&& ($2->lasti->memory->flags & NUMBER) != 0) {
+			long fnum = get_number_si($2->lasti->memory);
+
+			if (fnum > max_field_ref)
+				max_field_ref = fnum;
+		} else
+			dyn_field_ref = true;
 		$$ = list_append($2, $1);
 		if ($3 != NULL)
 			mk_assignment($2, NULL, $3);
@@ -2281,6 +2323,8 @@ parse_program(INSTRUCTION **pcode)
 	sourceline = 0;
 	if (ret == 0)	/* avoid spurious warning if parser aborted with YYABORT */
 		check_funcs();
+	if (ret == 0 && errcount == 0 && in_main_context())
+		inline_calls(*pcode);
 
 	if (args_array == NULL)
 		emalloc(args_array, NODE **, (max_args + 2) * sizeof(NODE *), "parse_program");
@@ -3519,7 +3563,7 @@ retry:
 			d = nondec2awknum(tokstart, strlen(tokstart));
 		else
 			d = atof(tokstart);
-		yylval->memory = make_number(d);
+		yylval->memory = make_unshared_number(d);
 		if (d <= INT32_MAX && d >= INT32_MIN && d == (int32_t) d)
 			yylval->memory->flags |= NUMINT;
 		return lasttok = YNUMBER;
@@ -3759,6 +3803,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 		r->sub_flags = 0;
 
 		arg = subn->nexti;		/* first arg list */
+		const_regexp(arg);
 		(void) mk_rexp(arg);
 
 		if (strcmp(operator, "gensub") != 0) {
@@ -3772,7 +3817,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 				INSTRUCTION *expr;
 
 				expr = list_create(instruction(Op_push_i));
-				expr->nexti->memory = make_number(0.0);
+				expr->nexti->memory = make_unshared_number(0.0);
 				(void) mk_expression_list(subn,
 						list_append(expr, instruction(Op_field_spec)));
 			}
@@ -3816,7 +3861,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 			r->sub_flags |= GENSUB;
 			if (nexp == 3) {
 				ip = instruction(Op_push_i);
-				ip->memory = make_number(0.0);
+				ip->memory = make_unshared_number(0.0);
 				(void) mk_expression_list(subn,
 						list_append(list_create(ip), instruction(Op_field_spec)));
 			}
@@ -3834,6 +3879,9 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 #endif
 		r->builtin = tokentab[idx].ptr;
 
+	if (subn != NULL && (ip = fold_builtin(subn, r, nexp)) != NULL)
+		return ip;
+
 	/* special case processing for a few builtins */
 
 	if (r->builtin == do_length) {
@@ -3845,7 +3893,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 			list = list_create(r);
 			(void) list_prepend(list, instruction(Op_field_spec));
 			(void) list_prepend(list, instruction(Op_push_i));
-			list->nexti->memory = make_number(0.0);
+			list->nexti->memory = make_unshared_number(0.0);
 			return list; 
 		} else {
 			arg = subn->nexti;
@@ -3860,6 +3908,7 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 		static bool warned = false;
 
 		arg = subn->nexti->lasti->nexti;	/* 2nd arg list */
+		const_regexp(arg);
 		(void) mk_rexp(arg);
 
 		if (nexp == 3) {	/* 3rd argument there */
@@ -3985,6 +4034,155 @@ snode(INSTRUCTION *subn, INSTRUCTION *r)
 }
 
 
+#define FOLD_MAX_ARGS	8	/* most arguments of a builtin folded at parse time */
+
+/* fold_sprintf_ok --- check that sprintf(fmt, args) can be done at parse time */
+
+static bool
+fold_sprintf_ok(NODE *fmt, NODE **args, int nargs)
+{
+	const char *cp = fmt->stptr;
+	const char *end = cp + fmt->stlen;
+	int cur = 0;
+	int ndigits;
+
+	/*
+	 * Only plain conversions with literal widths and precisions; `*',
+	 * positional arguments and the thousands grouping flag are all
+	 * left for run time.
+	 */
+	while (cp < end) {
+		if (*cp++ != '%')
+			continue;
+		if (cp < end && *cp == '%') {
+			cp++;
+			continue;
+		}
+		while (cp < end && strchr("-+ #0", *cp) != NULL)
+			cp++;
+		for (ndigits = 0; cp < end && isdigit((unsigned char) *cp); ndigits++)
+			cp++;
+		if (cp < end && *cp == '.') {
+			cp++;
+			while (cp < end && isdigit((unsigned char) *cp)) {
+				cp++;
+				ndigits++;
+			}
+		}
+		if (cp >= end || ndigits > 4 || ++cur >= nargs)
+			return false;
+
+		switch (*cp++) {
+		case 'c':
+		case 's':
+			/* a number's string value may depend on CONVFMT */
+			if ((args[cur]->flags & STRING) == 0)
+				return false;
+			break;
+		case 'd':
+		case 'i':
+		case 'o':
+		case 'u':
+		case 'x':
+		case 'X':
+		case 'e':
+		case 'E':
+		case 'f':
+		case 'F':
+		case 'g':
+		case 'G':
+			if ((args[cur]->flags & STRING) != 0)
+				return false;
+			break;
+		default:
+			return false;
+		}
+	}
+	return (cur == nargs - 1);
+}
+
+/* fold_builtin --- evaluate length, substr or sprintf of constants */
+
+static INSTRUCTION *
+fold_builtin(INSTRUCTION *subn, INSTRUCTION *r, int nexp)
+{
+	NODE *args[FOLD_MAX_ARGS];
+	NODE *res = NULL;
+	INSTRUCTION *arg, *next;
+	size_t i;
+
+	if (do_optimize < 2 || do_pretty_print || do_lint || do_mpfr
+			|| nexp > FOLD_MAX_ARGS)
+		return NULL;
+
+	nexp = 0;
+	for (arg = subn->nexti; arg != NULL; arg = arg->lasti->nexti) {
+		if (arg->nexti != arg->lasti || arg->nexti->opcode != Op_push_i
+				|| (arg->nexti->memory->flags & INTLSTR) != 0)
+			return NULL;
+		args[nexp++] = arg->nexti->memory;
+	}
+
+	if (r->builtin == do_length || r->builtin == do_substr) {
+		NODE *s = args[0];
+		size_t len, indx;
+		double d_index, d_length = 0;
+
+		/* keep to strings whose length in characters is their length in bytes */
+		if ((s->flags & STRING) == 0)
+			return NULL;
+		if (gawk_mb_cur_max > 1) {
+			for (i = 0; i < s->stlen; i++)
+				if ((unsigned char) s->stptr[i] >= 0x80)
+					return NULL;
+		}
+		len = s->stlen;
+
+		if (r->builtin == do_length)
+			res = make_unshared_number((AWKNUM) len);
+		else {
+			/* same rules as do_substr() */
+			if (((args[1]->flags | (nexp == 3 ? args[2]->flags : 0)) & STRING) != 0)
+				return NULL;
+			d_index = args[1]->numbr;
+			if (nexp == 3)
+				d_length = args[2]->numbr;
+
+			if (! (d_index >= 1))
+				d_index = 1;
+			if ((nexp == 3 && ! (d_length >= 1)) || d_index - 1 >= len)
+				res = dupnode(Nnull_string);
+			else {
+				indx = d_index - 1;
+				if (nexp == 2 || d_length > len - indx)
+					d_length = len - indx;
+				res = make_string(s->stptr + indx, (size_t) d_length);
+			}
+		}
+	} else if (r->builtin == do_sprintf) {
+		/* the program is parsed with LC_NUMERIC set to "C" */
+		if (use_lc_numeric || (args[0]->flags & STRING) == 0
+				|| ! fold_sprintf_ok(args[0], args, nexp))
+			return NULL;
+		res = format_tree(args[0]->stptr, args[0]->stlen, args, nexp);
+	}
+
+	if (res == NULL)
+		return NULL;
+
+	for (arg = subn->nexti; arg != NULL; arg = next) {
+		next = arg->lasti->nexti;
+		unref(arg->nexti->memory);
+		bcfree(arg->nexti);
+		bcfree(arg);
+	}
+	bcfree(subn);
+	r->opcode = Op_push_i;
+	r->memory = res;
+	return list_create(r);
+}
+
+
 /* parms_shadow --- check if parameters shadow globals */
 
 static int
@@ -4156,6 +4354,8 @@ mk_function(INSTRUCTION *fi, INSTRUCTION *def)
 	if (do_pretty_print)
 		(void) list_prepend(def, instruction(Op_exec_count));
 
+	fuse_field_refs(def);
+
 	/* fi->opcode = Op_func */
 	(fi + 1)->firsti = def->nexti;
 	(fi + 1)->lasti = def->lasti;
@@ -4511,6 +4711,37 @@ mk_rexp(INSTRUCTION *list)
 	return ip->memory;
 }
 
+/* const_regexp --- compile a constant string used as a regexp at parse time */
+
+static void
+const_regexp(INSTRUCTION *list)
+{
+	INSTRUCTION *ip = list->nexti;
+	NODE *n, *re;
+	size_t i;
+
+	if (do_optimize < 2 || do_pretty_print
+			|| ip != list->lasti || ip->opcode != Op_push_i)
+		return;
+
+	n = ip->memory;
+	if ((n->flags & (STRING|INTLSTR)) != STRING)
+		return;
+
+	/*
+	 * A bad dynamic regexp is a fatal error at run time, not a syntax
+	 * error, so only take text that is sure to compile.
+	 */
+	for (i = 0; i < n->stlen; i++)
+		if (n->stptr[i] == '\0' || strchr("\\()[]{}*+?", n->stptr[i]) != NULL)
+			return;
+
+	if ((re = make_regnode(Node_regex, n)) == NULL)
+		return;
+	ip->opcode = Op_match_rec;
+	ip->memory = re;
+}
+
 /* isnoeffect --- when used as a statement, has no side effects */
 
 static int
@@ -4533,10 +4764,13 @@ isnoeffect(OPCODE type)
 	case Op_exp_i:
 	case Op_unary_minus:
 	case Op_field_spec:
+	case Op_field_spec_i:
 	case Op_and_final:
 	case Op_or_final:
 	case Op_equal:
+	case Op_equal_i:
 	case Op_notequal:
+	case Op_notequal_i:
 	case Op_less:
 	case Op_greater:
 	case Op_leq:
@@ -4657,20 +4891,14 @@ mk_binary(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op)
 				res *= n2->numbr;
 				break;
 			case Op_quotient:
-				if (n2->numbr == 0.0) {
-					/* don't fatalize, allow parsing rest of the input */
-					error_ln(op->source_line, _("division by zero attempted"));
-					goto regular;
-				}
+				if (n2->numbr == 0.0)
+					goto regular;	/* fatal at run time, if reached */
 
 				res /= n2->numbr;
 				break;
 			case Op_mod:
-				if (n2->numbr == 0.0) {
-					/* don't fatalize, allow parsing rest of the input */
-					error_ln(op->source_line, _("division by zero attempted in `%%'"));
-					goto regular;
-				}
+				if (n2->numbr == 0.0)
+					goto regular;	/* fatal at run time, if reached */
 #ifdef HAVE_FMOD
 				res = fmod(res, n2->numbr);
 #else	/* ! HAVE_FMOD */
@@ -4692,7 +4920,7 @@ mk_binary(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op)
 			}
 
 			op->opcode = Op_push_i;
-			op->memory = make_number(res);
+			op->memory = make_unshared_number(res);
 			unref(n1);
 			unref(n2);
 			bcfree(ip1);
@@ -4739,6 +4967,63 @@ regular:
 	return list_append(s1, op);
 }
 
+/* fold_relop --- fold a comparison of two numeric constants into s1 */
+
+static bool
+fold_relop(INSTRUCTION *s1, INSTRUCTION *s2, INSTRUCTION *op)
+{
+	INSTRUCTION *ip1 = s1->nexti, *ip2 = s2->nexti;
+	NODE *n1, *n2;
+	int di;
+	bool res;
+
+	/*
+	 * String comparisons are left alone: they depend on IGNORECASE
+	 * and the locale, which can change at run time.
+	 */
+	if (do_optimize < 2 || do_pretty_print
+			|| ip1 != s1->lasti || ip1->opcode != Op_push_i
+			|| ip2 != s2->lasti || ip2->opcode != Op_push_i
+			|| (ip1->memory->flags & (MPFN|MPZN|STRCUR|STRING)) != 0
+			|| (ip2->memory->flags & (MPFN|MPZN|STRCUR|STRING)) != 0)
+		return false;
+
+	n1 = ip1->memory;
+	n2 = ip2->memory;
+	di = cmp_nodes(n1, n2);
+
+	switch (op->opcode) {
+	case Op_equal:
+		res = (di == 0);
+		break;
+	case Op_notequal:
+		res = (di != 0);
+		break;
+	case Op_less:
+		res = (di < 0);
+		break;
+	case Op_greater:
+		res = (di > 0);
+		break;
+	case Op_leq:
+		res = (di <= 0);
+		break;
+	case Op_geq:
+		res = (di >= 0);
+		break;
+	default:
+		return false;
+	}
+
+	ip1->memory = make_unshared_number((AWKNUM) res);
+	unref(n1);
+	unref(n2);
+	bcfree(ip2);
+	bcfree(s2);
+	bcfree(op);
+	return true;
+}
+
 /* mk_boolean --- instructions for boolean and, or */
  
 static INSTRUCTION *
@@ -4789,6 +5074,27 @@ mk_boolean(INSTRUCTION *left, INSTRUCTION *right, INSTRUCTION *op)
 	return list_merge(left, right);
 }
 
+/* ends_flow --- true if control never falls off the end of a statement list */
+
+static bool
+ends_flow(INSTRUCTION *list)
+{
+	if (do_optimize < 2 || do_pretty_print || do_debug)
+		return false;
+
+	switch (list->lasti->opcode) {
+	case Op_K_exit:
+	case Op_K_next:
+	case Op_K_nextfile:
+	case Op_K_return:
+	case Op_K_break:
+	case Op_K_continue:
+		return true;
+	default:
+		return false;
+	}
+}
+
 /* mk_condition --- if-else and conditional */
 
 static INSTRUCTION *
@@ -4815,6 +5121,28 @@ mk_condition(INSTRUCTION *cond, INSTRUCTION *ifp, INSTRUCTION *true_branch,
 
 	INSTRUCTION *ip;
 
+	/* a constant condition keeps only the branch it selects */
+	if (do_optimize > 1 && ! do_pretty_print && ! do_debug
+			&& cond->nexti == cond->lasti && cond->nexti->opcode == Op_push_i
+			&& (cond->nexti->memory->flags & (MPFN|MPZN|INTLSTR)) == 0
+	) {
+		NODE *n = cond->nexti->memory;
+		bool taken;
+
+		if ((n->flags & STRING) != 0)
+			taken = (n->stlen != 0);
+		else
+			taken = (n->numbr != 0.0);
+
+		unref(n);
+		bcfree(cond->nexti);
+		bcfree(cond);
+		bcfree(ifp);
+		if (elsep != NULL)
+			bcfree(elsep);
+		return taken ? true_branch : false_branch;
+	}
+
 	if (false_branch == NULL) {
 		false_branch = list_create(instruction(Op_no_op));
 		if (elsep != NULL) {		/* else { } */
@@ -4959,6 +5287,8 @@ append_rule(INSTRUCTION *pattern, INSTRUCTION *action)
 
 	list_append(rule_list, rp + 1);
 
+	fuse_field_refs(ip);
+
 	if (rule_block[rule] == NULL)
 		rule_block[rule] = ip;
 	else
@@ -5053,6 +5383,10 @@ optimize_assignment(INSTRUCTION *exp)
 	 * onto the runtime stack.
 	 */
 
+	fuse_field_refs(exp);
+	if ((i1 = optimize_plus_assign(exp)) != NULL)
+		return i1;
+
 	i2 = NULL;
 	i1 = exp->lasti;
 
@@ -5178,6 +5512,491 @@ optimize_assignment(INSTRUCTION *exp)
 }
 
 
+/*
+ * optimize_plus_assign --- superinstructions for adding to a variable or
+ * an array element in a statement of its own.
+ *
+ *   Replaces Op_push_lhs + Op_assign_plus + Op_pop (var += x), and
+ *   Op_push_lhs + Op_postincrement + Op_pop (var++, and likewise for
+ *   the other increment and decrement operators) with Op_store_plus.
+ *
+ *   Replaces Op_push_array + Op_subscript_lhs + Op_assign_plus + Op_pop
+ *   (array[sub] += x) and the array[sub]++ equivalents with
+ *   Op_store_sub_plus.  Like Op_store_sub, only for one dimension and a
+ *   subscript that is a single instruction.
+ *
+ * A constant increment is kept in initval.  Returns NULL if exp isn't
+ * one of these.
+ */
+
+static INSTRUCTION *
+optimize_plus_assign(INSTRUCTION *exp)
+{
+	INSTRUCTION *i1, *i2, *i3, *prev;
+	AWKNUM incr;
+
+	/* MPFR does its arithmetic in mpg_interpret(), which doesn't know these */
+	if (! do_optimize || do_pretty_print || do_mpfr)
+		return NULL;
+
+	i1 = exp->lasti;
+	switch (i1->opcode) {
+	case Op_preincrement:
+	case Op_postincrement:
+		incr = 1.0;
+		break;
+	case Op_predecrement:
+	case Op_postdecrement:
+		incr = -1.0;
+		break;
+	case Op_assign_plus:
+		incr = 0.0;
+		break;
+	default:
+		return NULL;
+	}
+
+	/* find the instruction before the operator, and the one before that */
+	prev = i2 = NULL;
+	for (i3 = exp->nexti; i3->nexti != i1; i3 = i3->nexti) {
+		prev = i2;
+		i2 = i3;
+	}
+	/* now i3 is just before i1, i2 before i3 and prev before i2 */
+
+	if (i3->opcode == Op_push_lhs) {
+		/* var += .. */
+		i3->opcode = Op_store_plus;
+	} else if (i3->opcode == Op_subscript_lhs
+			&& i3->sub_count == 1
+			&& (i2->opcode == Op_push
+				|| i2->opcode == Op_push_i
+				|| i2->opcode == Op_field_spec_i)
+			&& prev != NULL
+			&& prev->opcode == Op_push_array
+			&& prev->memory != symbol_table
+			&& prev->memory != func_table
+	) {
+		/* array[sub] += .. */
+		i3->opcode = Op_store_sub_plus;
+		i3->memory = prev->memory;
+
+		/* remove Op_push_array */
+		if (exp->nexti == prev)
+			exp->nexti = i2;
+		else {
+			INSTRUCTION *t;
+
+			for (t = exp->nexti; t->nexti != prev; t = t->nexti)
+				;
+			t->nexti = i2;
+		}
+		bcfree(prev);
+	} else
+		return NULL;
+
+	i3->initval = NULL;
+	if (incr != 0.0)
+		i3->initval = make_unshared_number(incr);
+	else if (exp->nexti->opcode == Op_push_i
+			&& exp->nexti->nexti == i3
+			&& (exp->nexti->memory->flags & (NUMBER|NUMCUR)) == (NUMBER|NUMCUR)
+	) {
+		/* constant increment, var += 2 */
+		i2 = exp->nexti;
+		i3->initval = i2->memory;
+		exp->nexti = i3;
+		bcfree(i2);
+	}
+
+	i3->nexti = NULL;
+	bcfree(i1);		/* the operator */
+	exp->lasti = i3;	/* update Op_list */
+	return exp;
+}
+
+/*
+ * fuse_field_refs --- peephole pass over a finished rule or function
+ * body, or an expression statement.  Replaces Op_push_i + Op_field_spec
+ * ($n for a constant n) with a single Op_field_spec_i.
+ *
+ * Op_field_spec is never a jump target, and $n is only fused where it
+ * is no longer needed as an lvalue, so nothing can point at the
+ * instruction that goes away.
+ */
+
+static void
+fuse_field_refs(INSTRUCTION *list)
+{
+	INSTRUCTION *ip, *fp;
+
+	if (! do_optimize || do_pretty_print)
+		return;
+
+	for (ip = list->nexti; ip != NULL && ip != list->lasti; ip = ip->nexti) {
+		fp = ip->nexti;
+		if (ip->opcode != Op_push_i || fp->opcode != Op_field_spec
+				|| (ip->memory->flags & (NUMBER|INTLSTR)) != NUMBER)
+			continue;
+		ip->opcode = Op_field_spec_i;
+		ip->nexti = fp->nexti;
+		if (list->lasti == fp)
+			list->lasti = ip;
+		bcfree(fp);
+	}
+}
+
+/*
+ * Inlining of small functions, with -O.
+ *
+ * A call to a function that is short, calls no other function, and uses
+ * its parameters and locals only as scalars is replaced by a copy of the
+ * function body:
+ *
+ *	[args] Op_func_call
+ * becomes
+ *	[args] Op_inline_enter [body] Op_inline_leave
+ *
+ * with each Op_K_return in the body turned into a jump to
+ * Op_inline_leave.  The parameters and locals become hidden variables,
+ * one set per function; as the body can't call anything, nothing can
+ * re-enter it while they are in use.  Op_inline_enter binds the argument
+ * values to them.  An argument that isn't a value (an untyped variable
+ * or an array, whose type the callee might change) makes it jump to an
+ * ordinary call instead.
+ *
+ * Not done when profiling, so that counts are still kept per function,
+ * nor for the debugger or lint.
+ */
+
+#define INLINE_MAX_SIZE	40	/* instructions in an inlined body */
+
+struct inline_func {
+	NODE *func;
+	NODE *vars;	/* hidden parameters and locals, NULL if not inlinable */
+};
+
+/* inline_in_body --- true if ip is one of the instructions first .. last */
+
+static bool
+inline_in_body(INSTRUCTION *ip, INSTRUCTION *first, INSTRUCTION *last)
+{
+	INSTRUCTION *t;
+
+	for (t = first; t != NULL; t = t->nexti) {
+		if (t == ip)
+			return true;
+		if (t == last)
+			break;
+	}
+	return false;
+}
+
+/* inline_ok --- check that function f can be inlined */
+
+static bool
+inline_ok(NODE *f)
+{
+	INSTRUCTION *first, *last, *ip;
+	int size = 0;
+
+	first = f->code_ptr->nexti;
+	last = (f->code_ptr + 1)->lasti;
+
+	for (ip = first; ; ip = ip->nexti) {
+		if (++size > INLINE_MAX_SIZE)
+			return false;
+
+		switch (ip->opcode) {
+		case Op_push:
+		case Op_push_arg:
+		case Op_push_lhs:
+		case Op_store_var:
+		case Op_store_plus:
+		case Op_assign_concat:
+			/* parameters are fine as scalars */
+			break;
+
+		case Op_push_array:
+		case Op_store_sub:
+		case Op_store_sub_plus:
+			if (ip->memory->type == Node_param_list)
+				return false;
+			break;
+
+		case Op_jmp:
+		case Op_jmp_true:
+		case Op_jmp_false:
+		case Op_and:
+		case Op_or:
+		case Op_K_break:
+		case Op_K_continue:
+			if (! inline_in_body(ip->target_jmp, first, last))
+				return false;
+			break;
+
+		case Op_field_spec_lhs:
+			if (ip->target_assign != NULL
+					&& ! inline_in_body(ip->target_assign, first, last))
+				return false;
+			break;
+
+		case Op_builtin:
+			/* these can call a user-defined comparison function */
+			if (ip->builtin == do_asort || ip->builtin == do_asorti)
+				return false;
+			break;
+
+		case Op_times:
+		case Op_times_i:
+		case Op_quotient:
+		case Op_quotient_i:
+		case Op_mod:
+		case Op_mod_i:
+		case Op_plus:
+		case Op_plus_i:
+		case Op_minus:
+		case Op_minus_i:
+		case Op_exp:
+		case Op_exp_i:
+		case Op_concat:
+		case Op_subscript:
+		case Op_sub_array:
+		case Op_preincrement:
+		case Op_predecrement:
+		case Op_postincrement:
+		case Op_postdecrement:
+		case Op_unary_minus:
+		case Op_field_spec:
+		case Op_field_spec_i:
+		case Op_not:
+		case Op_assign:
+		case Op_store_field:
+		case Op_assign_times:
+		case Op_assign_quotient:
+		case Op_assign_mod:
+		case Op_assign_plus:
+		case Op_assign_minus:
+		case Op_assign_exp:
+		case Op_and_final:
+		case Op_or_final:
+		case Op_equal:
+		case Op_equal_i:
+		case Op_notequal:
+		case Op_notequal_i:
+		case Op_less:
+		case Op_greater:
+		case Op_leq:
+		case Op_geq:
+		case Op_match:
+		case Op_match_rec:
+		case Op_nomatch:
+		case Op_K_print:
+		case Op_K_print_rec:
+		case Op_K_printf:
+		case Op_K_delete:
+		case Op_K_return:
+		case Op_sub_builtin:
+		case Op_in_array:
+		case Op_push_i:
+		case Op_push_re:
+		case Op_subscript_lhs:
+		case Op_no_op:
+		case Op_pop:
+		case Op_var_update:
+		case Op_var_assign:
+		case Op_field_assign:
+			break;
+
+		default:
+			/*
+			 * Calls, getline, next, exit, and for-in and switch,
+			 * which keep state on the stack.
+			 */
+			return false;
+		}
+
+		if (ip == last)
+			break;
+	}
+	return true;
+}
+
+/* make_inline_vars --- make the hidden variables for an inlinable function */
+
+static NODE *
+make_inline_vars(NODE *f)
+{
+	NODE *vars;
+	int i;
+
+	emalloc(vars, NODE *, (f->param_cnt + 1) * sizeof(NODE), "make_inline_vars");
+	memset(vars, 0, (f->param_cnt + 1) * sizeof(NODE));
+	for (i = 0; i < f->param_cnt; i++) {
+		vars[i].type = Node_var;
+		vars[i].vname = f->fparms[i].param;
+		vars[i].var_value = dupnode(Nnull_string);
+	}
+	return vars;
+}
+
+/* inline_call --- replace the call at pc with a copy of f's body */
+
+static void
+inline_call(INSTRUCTION *pc, NODE *f, NODE *vars)
+{
+	INSTRUCTION *old[INLINE_MAX_SIZE], *new[INLINE_MAX_SIZE];
+	INSTRUCTION *ip, *last, *leave, *call;
+	NODE *m;
+	int i, j, n;
+
+	last = (f->code_ptr + 1)->lasti;
+	n = 0;
+	for (ip = f->code_ptr->nexti; ; ip = ip->nexti) {
+		old[n] = ip;
+		new[n] = instruction(ip->opcode);
+		*new[n] = *ip;
+		n++;
+		if (ip == last)
+			break;
+	}
+
+	leave = instruction(Op_inline_leave);
+	leave->inline_vars = vars;
+	leave->expr_count = f->param_cnt;
+
+	for (i = 0; i < n; i++) {
+		ip = new[i];
+		ip->nexti = (i < n - 1) ? new[i + 1] : leave;
+
+		switch (ip->opcode) {
+		case Op_K_return:
+			ip->opcode = Op_jmp;
+			ip->target_jmp = leave;
+			break;
+
+		case Op_jmp:
+		case Op_jmp_true:
+		case Op_jmp_false:
+		case Op_and:
+		case Op_or:
+		case Op_K_break:
+		case Op_K_continue:
+			for (j = 0; old[j] != ip->target_jmp; j++)
+				;
+			ip->target_jmp = new[j];
+			break;
+
+		case Op_field_spec_lhs:
+			if (ip->target_assign != NULL) {
+				for (j = 0; old[j] != ip->target_assign; j++)
+					;
+				ip->target_assign = new[j];
+			}
+			break;
+
+		case Op_push:
+		case Op_push_arg:
+		case Op_push_lhs:
+		case Op_store_var:
+		case Op_store_plus:
+		case Op_assign_concat:
+			m = ip->memory;
+			if (m->type == Node_param_list)
+				ip->memory = & vars[m->param_cnt];
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	/* keep a real call for arguments Op_inline_enter can't bind */
+	call = bcalloc(Op_func_call, 2, pc->source_line);
+	memcpy(call, pc, 2 * sizeof(INSTRUCTION));
+	leave->nexti = pc->nexti;
+
+	pc->opcode = Op_inline_enter;
+	pc->inline_vars = vars;
+	pc->expr_count = (pc + 1)->expr_count;
+	(pc + 1)->expr_count = f->param_cnt;
+	(pc + 1)->target_call = call;
+	pc->nexti = new[0];
+}
+
+/* inline_list --- inline the calls in first .. last, written in source file src */
+
+static void
+inline_list(INSTRUCTION *first, INSTRUCTION *last, const char *src,
+		struct inline_func *funcs, size_t nfuncs)
+{
+	INSTRUCTION *pc;
+	NODE *f;
+	size_t i;
+
+	for (pc = first; pc != NULL; pc = pc->nexti) {
+		if (pc->opcode == Op_rule)
+			src = pc->source_file;
+		else if (pc->opcode == Op_func_call
+				&& (f = lookup(pc->func_name)) != NULL
+				&& f->type == Node_func
+				&& (pc + 1)->expr_count <= f->param_cnt
+				&& f->code_ptr->source_file == src
+		) {
+			for (i = 0; i < nfuncs && funcs[i].func != f; i++)
+				;
+			if (i < nfuncs && funcs[i].vars != NULL)
+				inline_call(pc, f, funcs[i].vars);
+		}
+		if (pc == last)
+			break;
+	}
+}
+
+/* inline_calls --- inline calls to small functions in the whole program */
+
+static void
+inline_calls(INSTRUCTION *code)
+{
+	NODE **list;
+	struct inline_func *funcs;
+	size_t i, nfuncs;
+	NODE *f;
+
+	if (do_optimize < 2 || do_debug || do_profile || do_pretty_print || do_lint)
+		return;
+
+	list = function_list(false);
+	for (nfuncs = 0; list[nfuncs] != NULL; nfuncs++)
+		;
+	if (nfuncs == 0) {
+		efree(list);
+		return;
+	}
+
+	/* decide before changing anything, inlining makes callers bigger */
+	emalloc(funcs, struct inline_func *, nfuncs * sizeof(struct inline_func), "inline_calls");
+	for (i = 0; i < nfuncs; i++) {
+		f = list[i];
+		funcs[i].func = f;
+		funcs[i].vars = NULL;
+		if (f->type == Node_func && inline_ok(f))
+			funcs[i].vars = make_inline_vars(f);
+	}
+
+	inline_list(code, NULL, NULL, funcs, nfuncs);
+	for (i = 0; i < nfuncs; i++) {
+		f = funcs[i].func;
+		if (f->type == Node_func)
+			inline_list(f->code_ptr->nexti, (f->code_ptr + 1)->lasti,
+					f->code_ptr->source_file, funcs, nfuncs);
+	}
+
+	efree(funcs);
+	efree(list);
+}
+
+
 /* mk_getline --- make instructions for getline */
 
 static INSTRUCTION *
@@ -1565,13 +1565,425 @@ out:
 }
 
 
-/* printf_common --- common code for sprintf and printf */
+/*
+ * Compiled formats.
+ *
+ * Most printf and sprintf formats are constants, yet format_tree()
+ * parses them again on every call.  fmt_compile() splits a format
+ * into literal text and conversions once, and format_fast() then only
+ * has to convert the arguments.  Only simple conversions are compiled:
+ * %s, %d, %i, %o, %u, %x, %X, %e, %E, %f, %g and %G with the flags
+ * `-', `+', ` ', `#' and `0' and a literal width and precision.
+ * Other formats, and values that format_tree() treats specially, are
+ * still done by format_tree().  The code below follows format_tree()
+ * step by step, so that the output is the same.
+ */
 
-static NODE *
-printf_common(int nargs)
+struct fmt_spec {
+	const char *lit;	/* literal text before the conversion */
+	size_t lit_len;
+	char conv;		/* conversion letter, '\0' for trailing text */
+	char signchar;		/* '+', ' ' or '\0' */
+	bool lj, alt, zero_flag, have_prec;
+	long fw, prec;
+	char cfmt[12];		/* C format for %e, %f and %g */
+};
+
+struct compiled_fmt {
+	struct compiled_fmt *next;	/* most recently used first */
+	char *text;		/* copy of the format */
+	size_t len;
+	long nargs;		/* arguments used, -1 for format_tree() */
+	struct fmt_spec *specs;	/* ends with a '\0' conversion */
+};
+
+#define FMT_CACHE_SIZE	8	/* formats kept compiled */
+#define FMT_MAX_DIGITS	6	/* in a compiled width or precision */
+
+static struct compiled_fmt *fmt_cache = NULL;
+
+#define PRINTF_BUF_KEEP	BUFSIZ	/* largest printf_buf kept between calls */
+
+struct fmt_out {
+	char *buf;
+	size_t size;
+	size_t len;
+};
+
+static struct fmt_out printf_buf;	/* output of printf, reused */
+
+/* fmt_room --- make room for n more bytes, and a final '\0' */
+
+static void
+fmt_room(struct fmt_out *out, size_t n)
+{
+	if (out->len + n + 2 > out->size) {
+		out->size = out->size * 2 + n + 64;
+		erealloc(out->buf, char *, out->size, "fmt_room");
+	}
+}
+
+/* fmt_put --- add l bytes from s to the output */
+
+static inline void
+fmt_put(struct fmt_out *out, const char *s, size_t l)
+{
+	fmt_room(out, l);
+	memcpy(out->buf + out->len, s, l);
+	out->len += l;
+}
+
+/* fmt_fill --- add n copies of c to the output */
+
+static inline void
+fmt_fill(struct fmt_out *out, char c, long n)
+{
+	if (n <= 0)
+		return;
+	fmt_room(out, n);
+	memset(out->buf + out->len, c, n);
+	out->len += n;
+}
+
+/* fmt_number --- read at most FMT_MAX_DIGITS digits of a width or precision */
+
+static bool
+fmt_number(const char **sp, const char *end, long *val)
+{
+	const char *s = *sp;
+	int ndigits = 0;
+
+	*val = 0;
+	for (; s < end && isdigit((unsigned char) *s); s++) {
+		if (++ndigits > FMT_MAX_DIGITS)
+			return false;
+		*val = *val * 10 + (*s - '0');
+	}
+	*sp = s;
+	return true;
+}
+
+/* fmt_compile --- split a format into literal text and conversions */
+
+static struct compiled_fmt *
+fmt_compile(const char *fmt, size_t len)
+{
+	struct compiled_fmt *cf;
+	struct fmt_spec *sp;
+	const char *s0, *s1, *end;
+	char *cp;
+	size_t i, n;
+
+	emalloc(cf, struct compiled_fmt *, sizeof(struct compiled_fmt), "fmt_compile");
+	emalloc(cf->text, char *, len + 1, "fmt_compile");
+	memcpy(cf->text, fmt, len);
+	cf->len = len;
+	cf->nargs = 0;
+
+	for (i = 0, n = 1; i < len; i++)
+		if (fmt[i] == '%')
+			n++;
+	emalloc(cf->specs, struct fmt_spec *, n * sizeof(struct fmt_spec), "fmt_compile");
+
+	s0 = s1 = cf->text;
+	end = s1 + len;
+	sp = cf->specs;
+	while (s1 < end) {
+		if (*s1 != '%') {
+			s1++;
+			continue;
+		}
+		memset(sp, 0, sizeof(struct fmt_spec));
+		sp->lit = s0;
+		sp->lit_len = s1 - s0;
+		if (++s1 < end && *s1 == '%') {
+			sp->conv = '%';
+			s0 = ++s1;
+			sp++;
+			continue;
+		}
+
+		for (; s1 < end; s1++) {
+			if (*s1 == '-')
+				sp->lj = true;
+			else if (*s1 == '+')
+				sp->signchar = '+';
+			else if (*s1 == ' ') {
+				if (sp->signchar == '\0')
+					sp->signchar = ' ';
+			} else if (*s1 == '#')
+				sp->alt = true;
+			else if (*s1 == '0')
+				sp->zero_flag = true;
+			else
+				break;
+		}
+		if (! fmt_number(& s1, end, & sp->fw))
+			goto no_compile;
+		if (s1 < end && *s1 == '.') {
+			s1++;
+			sp->have_prec = true;
+			if (! fmt_number(& s1, end, & sp->prec))
+				goto no_compile;
+		}
+		if (s1 == end || *s1 == '\0' || strchr("sdiouxXeEfgG", *s1) == NULL)
+			goto no_compile;
+		sp->conv = *s1++;
+		cf->nargs++;
+
+		if (strchr("eEfgG", sp->conv) != NULL) {
+			/* the same format that format_tree() hands to snprintf() */
+			cp = sp->cfmt;
+			*cp++ = '%';
+			if (sp->lj)
+				*cp++ = '-';
+			if (sp->signchar)
+				*cp++ = sp->signchar;
+			if (sp->alt)
+				*cp++ = '#';
+			if (sp->zero_flag)
+				*cp++ = '0';
+			sprintf(cp, "*.*%c", sp->conv);
+		}
+		s0 = s1;
+		sp++;
+	}
+	memset(sp, 0, sizeof(struct fmt_spec));
+	sp->lit = s0;
+	sp->lit_len = end - s0;
+	return cf;
+
+no_compile:
+	cf->nargs = -1;
+	return cf;
+}
+
+/* fmt_lookup --- find or make the compiled form of a format */
+
+static struct compiled_fmt *
+fmt_lookup(const char *fmt, size_t len)
+{
+	struct compiled_fmt *cf, *prev = NULL, *last_prev = NULL;
+	int count = 0;
+
+	for (cf = fmt_cache; cf != NULL; prev = cf, cf = cf->next) {
+		if (cf->len == len && memcmp(cf->text, fmt, len) == 0) {
+			if (prev != NULL) {
+				/* move to front */
+				prev->next = cf->next;
+				cf->next = fmt_cache;
+				fmt_cache = cf;
+			}
+			return cf;
+		}
+		last_prev = prev;
+		count++;
+	}
+
+	if (count >= FMT_CACHE_SIZE) {
+		/* drop the least recently used one; prev is the last one */
+		if (last_prev != NULL)
+			last_prev->next = NULL;
+		else
+			fmt_cache = NULL;
+		efree(prev->text);
+		efree(prev->specs);
+		efree(prev);
+	}
+
+	cf = fmt_compile(fmt, len);
+	cf->next = fmt_cache;
+	fmt_cache = cf;
+	return cf;
+}
+
+/* fmt_tail --- add a converted value of n bytes, padded to fw, as format_tree() does */
+
+static void
+fmt_tail(struct fmt_out *out, const char *cp, long prec, long fw,
+		bool lj, char fill, size_t copy_count)
+{
+	if (! lj) {
+		fmt_fill(out, fill, fw - prec);
+		fw = prec;
+	}
+	fmt_put(out, cp, copy_count);
+	fmt_fill(out, fill, fw - prec);
+}
+
+/* format_fast --- format with a compiled format; false if format_tree() is needed */
+
+static bool
+format_fast(NODE *fmt, NODE **the_args, long num_args, struct fmt_out *out)
+{
+	struct compiled_fmt *cf;
+	struct fmt_spec *sp;
+	long cur_arg = 1;
+	NODE *arg;
+	AWKNUM tmpval;
+	uintmax_t uval;
+	char nbuf[100];
+	char *cp, *cend = nbuf + sizeof(nbuf);
+	const char *chbuf;
+	long fw, prec;
+	char fill;
+	int base, nc;
+
+	/* lint wants to hear about bad formats; MPFR numbers need format_tree() */
+	if (do_lint || do_mpfr)
+		return false;
+
+	cf = fmt_lookup(fmt->stptr, fmt->stlen);
+	if (cf->nargs < 0 || cf->nargs > num_args - 1)
+		return false;
+
+	for (sp = cf->specs; ; sp++) {
+		fmt_put(out, sp->lit, sp->lit_len);
+		if (sp->conv == '\0')
+			break;
+		if (sp->conv == '%') {
+			fmt_put(out, "%", 1);
+			continue;
+		}
+
+		arg = the_args[cur_arg++];
+		fw = sp->fw;
+		prec = sp->prec;
+		fill = ' ';
+		cp = cend;
+
+		switch (sp->conv) {
+		case 's':
+			arg = force_string(arg);
+			if (fw == 0 && ! sp->have_prec) {
+				fmt_put(out, arg->stptr, arg->stlen);
+				break;
+			}
+			nc = mbc_char_count(arg->stptr, arg->stlen);
+			if (! sp->have_prec || prec > nc)
+				prec = nc;
+			fmt_tail(out, arg->stptr, prec, fw, sp->lj, fill,
+				gawk_mb_cur_max > 1 ? mbc_byte_count(arg->stptr, prec) : prec);
+			break;
+
+		case 'd':
+		case 'i':
+			tmpval = force_number(arg)->numbr;
+			/* format_tree() has special cases for these */
+			if (isnan(tmpval) || isinf(tmpval))
+				return false;
+			tmpval = double_to_int(tmpval);
+			if (sp->have_prec && prec == 0 && tmpval == 0) {
+				fmt_tail(out, cp, 0, fw, sp->lj, fill, 0);
+				break;
+			}
+			if (tmpval <= -1e18 || tmpval >= 1e18)
+				return false;
+
+			uval = (uintmax_t) (tmpval < 0 ? -tmpval : tmpval);
+			do {
+				*--cp = '0' + uval % 10;
+				uval /= 10;
+			} while (uval > 0);
+			if (sp->have_prec && prec > sizeof(nbuf) - 2)
+				return false;
+			while (cend - cp < prec)
+				*--cp = '0';
+			if (tmpval < 0)
+				*--cp = '-';
+			else if (sp->signchar)
+				*--cp = sp->signchar;
+
+			if (! sp->lj && ((sp->zero_flag && ! sp->have_prec)
+					|| (fw == 0 && sp->have_prec)))
+				fill = '0';
+			if (prec > fw)
+				fw = prec;
+			prec = cend - cp;
+			if (fw > prec && ! sp->lj && fill != ' '
+			    && (*cp == '-' || sp->signchar)) {
+				fmt_put(out, cp, 1);
+				cp++;
+				prec--;
+				fw--;
+			}
+			fmt_tail(out, cp, prec, fw, sp->lj, fill, prec);
+			break;
+
+		case 'X':
+		case 'x':
+		case 'u':
+		case 'o':
+			base = (sp->conv == 'o') ? 8 : (sp->conv == 'u') ? 10 : 16;
+			chbuf = (sp->conv == 'X') ? "0123456789ABCDEF" : "0123456789abcdef";
+			tmpval = force_number(arg)->numbr;
+			if (isnan(tmpval) || tmpval <= -1e18 || tmpval >= 1e18)
+				return false;
+			if (! sp->alt && sp->have_prec && prec == 0 && tmpval == 0) {
+				fmt_tail(out, cp, 0, fw, sp->lj, fill, 0);
+				break;
+			}
+			if (tmpval < 0)
+				uval = (uintmax_t) (intmax_t) tmpval;
+			else
+				uval = (uintmax_t) tmpval;
+
+			if (! sp->lj && ((sp->zero_flag && ! sp->have_prec)
+					|| (fw == 0 && sp->have_prec)))
+				fill = '0';
+			do {
+				*--cp = chbuf[uval % base];
+				uval /= base;
+			} while (uval > 0);
+			if (sp->have_prec && prec > sizeof(nbuf) - 4)
+				return false;
+			while (cend - cp < prec)
+				*--cp = '0';
+			if (sp->alt && tmpval != 0) {
+				if (base == 16) {
+					*--cp = sp->conv;
+					*--cp = '0';
+					if (fill != ' ') {
+						fmt_put(out, cp, 2);
+						cp += 2;
+						fw -= 2;
+					}
+				} else if (base == 8)
+					*--cp = '0';
+			}
+			if (prec > fw)
+				fw = prec;
+			prec = cend - cp;
+			fmt_tail(out, cp, prec, fw, sp->lj, fill, prec);
+			break;
+
+		default:	/* e, E, f, g, G */
+			tmpval = force_number(arg)->numbr;
+			if (! sp->have_prec)
+				prec = DEFAULT_G_PRECISION;
+			for (;;) {
+				nc = snprintf(out->buf + out->len, out->size - out->len,
+						sp->cfmt, (int) fw, (int) prec, (double) tmpval);
+				if (nc < 0)
+					return false;
+				if (out->len + nc + 2 <= out->size)
+					break;
+				fmt_room(out, nc);
+			}
+			out->len += nc;
+			break;
+		}
+	}
+	return true;
+}
+
+/* printf_args --- pop the arguments of sprintf and printf into args_array */
+
+static void
+printf_args(int nargs)
 {
 	int i;
-	NODE *r, *tmp;
+	NODE *tmp;
 
 	assert(nargs <= max_args);
 	for (i = 1; i <= nargs; i++) {
@@ -1584,7 +1996,27 @@ printf_common(int nargs)
 	}
 
 	args_array[0] = force_string(args_array[0]);
-	r = format_tree(args_array[0]->stptr, args_array[0]->stlen, args_array, nargs);
+}
+
+/* printf_common --- format the arguments of sprintf into a new string */
+
+static NODE *
+printf_common(int nargs)
+{
+	int i;
+	NODE *r;
+	struct fmt_out out;
+
+	printf_args(nargs);
+	out.buf = NULL;
+	out.size = out.len = 0;
+	if (format_fast(args_array[0], args_array, nargs, & out))
+		r = make_str_node(out.buf, out.len, ALREADY_MALLOCED);
+	else {
+		if (out.buf != NULL)
+			efree(out.buf);
+		r = format_tree(args_array[0]->stptr, args_array[0]->stlen, args_array, nargs);
+	}
 	for (i = 0; i < nargs; i++)
 		DEREF(args_array[i]);
 	return r;
@@ -1609,10 +2041,13 @@ void
 do_printf(int nargs, int redirtype)
 {
 	FILE *fp = NULL;
-	NODE *tmp;
+	NODE *tmp = NULL;
 	struct redirect *rp = NULL;
 	int errflg;	/* not used, sigh */
 	NODE *redir_exp = NULL;
+	const char *buf;
+	size_t len;
+	int i;
 
 	if (nargs == 0) {
 		if (do_traditional) {
@@ -1641,22 +2076,41 @@ do_printf(int nargs, int redirtype)
 	} else
 		fp = output_fp;
 
-	tmp = printf_common(nargs);
+	/*
+	 * Format into printf_buf, which is kept from one call to the
+	 * next, and write that out; only format_tree() makes a NODE.
+	 */
+	printf_args(nargs);
+	printf_buf.len = 0;
+	if (format_fast(args_array[0], args_array, nargs, & printf_buf)) {
+		buf = printf_buf.buf;
+		len = printf_buf.len;
+	} else {
+		tmp = format_tree(args_array[0]->stptr, args_array[0]->stlen, args_array, nargs);
+		buf = tmp->stptr;
+		len = tmp->stlen;
+	}
+	for (i = 0; i < nargs; i++)
+		DEREF(args_array[i]);
 	if (redir_exp != NULL) {
 		DEREF(redir_exp);
 		decr_sp();
 	}
-	if (tmp != NULL) {
-		if (fp == NULL) {
-			DEREF(tmp);
-			return;
-		}
-		efwrite(tmp->stptr, sizeof(char), tmp->stlen, fp, "printf", rp, true);
+
+	if (fp != NULL) {
+		efwrite(buf, sizeof(char), len, fp, "printf", rp, true);
 		if (rp != NULL && (rp->flag & RED_TWOWAY) != 0)
 			rp->output.gawk_fflush(rp->output.fp, rp->output.opaque);
+	}
+	if (tmp != NULL)
 		DEREF(tmp);
-	} else
-		gawk_exit(EXIT_FATAL);
+
+	/* don't hold on to the space used by one very long line */
+	if (printf_buf.size > PRINTF_BUF_KEEP) {
+		efree(printf_buf.buf);
+		printf_buf.buf = NULL;
+		printf_buf.size = 0;
+	}
 }
 
 /* do_sqrt --- do the sqrt function */
@@ -1791,10 +2245,13 @@ do_substr(int nargs)
 
 #if MBS_SUPPORT
 	/* force_wstring() already called */
-	if (gawk_mb_cur_max == 1 || t1->wstlen == t1->stlen)
+	if (gawk_mb_cur_max == 1 || t1->wstlen == t1->stlen) {
 		/* single byte case */
-		r = make_string(t1->stptr + indx, length);
-	else {
+		if (length == 1)
+			r = make_char_node(t1->stptr[indx]);
+		else
+			r = make_string(t1->stptr + indx, length);
+	} else {
 		/* multibyte case, more work */
 		size_t result;
 		wchar_t *wp;
@@ -1820,7 +2277,10 @@ do_substr(int nargs)
 		r = make_str_node(substr, cp - substr, ALREADY_MALLOCED);
 	}
 #else
-	r = make_string(t1->stptr + indx, length);
+	if (length == 1)
+		r = make_char_node(t1->stptr[indx]);
+	else
+		r = make_string(t1->stptr + indx, length);
 #endif
 
 	DEREF(t1);
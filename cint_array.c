@@ -1159,7 +1159,7 @@ leaf_list(NODE *array, NODE **list, unsigned int flags)
 			subs->numbr = num;
 			subs->flags |= (NUMCUR|NUMINT);
 		} else {
-			subs = make_number((AWKNUM) num);
+			subs = make_unshared_number((AWKNUM) num);
 			subs->flags |= (INTIND|NUMINT);
 		}
 		list[k++] = subs;
@@ -1192,7 +1192,7 @@ leaf_info(NODE *array, NODE *ndump, const char *aname)
 
 	size = array->array_size;
 
-	subs = make_number((AWKNUM) 0.0);
+	subs = make_unshared_number((AWKNUM) 0.0);
 	subs->flags |= (INTIND|NUMINT);
 	for (i = 0; i < size; i++) {
 		val = array->nodes[i];
@@ -3181,7 +3181,7 @@ err:
 			}			
 		} else 
 #endif
-			r = make_number(strtod(tokstart, & lexptr));
+			r = make_unshared_number(strtod(tokstart, & lexptr));
 
 		if (errno != 0) {
 			yyerror(strerror(errno));
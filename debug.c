@@ -3809,6 +3809,11 @@ print_instruction(INSTRUCTION *pc, Func_print print_func, FILE *fp, int in_dump)
 		                pc->func_name, (pc + 1)->expr_count);
 		break;
 
+	case Op_inline_enter:
+		print_func(fp, "[arg_count = %ld] [param_cnt = %ld] [target_call = %p]\n",
+		                pc->expr_count, (pc + 1)->expr_count, (pc + 1)->target_call);
+		break;
+
 	case Op_K_nextfile:
 		print_func(fp, "[target_newfile = %p] [target_endfile = %p]\n",
 		                pc->target_newfile, pc->target_endfile);
@@ -3951,6 +3956,16 @@ print_instruction(INSTRUCTION *pc, Func_print print_func, FILE *fp, int in_dump)
 		print_func(fp, "\n");
 		break;
 
+	case Op_store_plus:
+	case Op_store_sub_plus:
+		print_memory(pc->memory, func, print_func, fp);
+		if (pc->initval != NULL) {
+			print_func(fp, " += ");
+			print_memory(pc->initval, func, print_func, fp);
+		}
+		print_func(fp, "\n");
+		break;
+
 	case Op_push_lhs:
 		print_memory(pc->memory, func, print_func, fp);
 		print_func(fp, " [do_reference = %s]\n",
@@ -3972,6 +3987,9 @@ print_instruction(INSTRUCTION *pc, Func_print print_func, FILE *fp, int in_dump)
 	case Op_exp_i:
 	case Op_quotient_i:
 	case Op_mod_i:
+	case Op_equal_i:
+	case Op_notequal_i:
+	case Op_field_spec_i:
 	case Op_assign_concat:
 		print_memory(pc->memory, func, print_func, fp);
 		/* fall through */
@@ -286,11 +286,14 @@ static struct optypetab {
 	{ "Op_postdecrement", "--" },
 	{ "Op_unary_minus", "-" },
 	{ "Op_field_spec", "$" },
+	{ "Op_field_spec_i", "$" },
 	{ "Op_not", "! " },
 	{ "Op_assign", " = " },
 	{ "Op_store_var", " = " },
 	{ "Op_store_sub", " = " },
 	{ "Op_store_field", " = " },
+	{ "Op_store_plus", " += " },
+	{ "Op_store_sub_plus", " += " },
 	{ "Op_assign_times", " *= " },
 	{ "Op_assign_quotient", " /= " },
 	{ "Op_assign_mod", " %= " },
@@ -303,7 +306,9 @@ static struct optypetab {
 	{ "Op_or", " || " },
 	{ "Op_or_final", NULL },
 	{ "Op_equal", " == " },
+	{ "Op_equal_i", " == " },
 	{ "Op_notequal", " != " },
+	{ "Op_notequal_i", " != " },
 	{ "Op_less", " < " },
 	{ "Op_greater", " > " },
 	{ "Op_leq", " <= " },
@@ -333,6 +338,8 @@ static struct optypetab {
 	{ "Op_in_array", " in " },
 	{ "Op_func_call", NULL },
 	{ "Op_indirect_func_call", NULL },
+	{ "Op_inline_enter", NULL },
+	{ "Op_inline_leave", NULL },
 	{ "Op_push", NULL },
 	{ "Op_push_arg", NULL },
 	{ "Op_push_i", NULL },
@@ -438,6 +445,7 @@ flags2str(int flagval)
 		{ WSTRCUR, "WSTRCUR" },
 		{ MPFN,	"MPFN" },
 		{ MPZN,	"MPZN" },
+		{ STRCAP, "STRCAP" },
 		{ ARRAYMAXED, "ARRAYMAXED" },
 		{ HALFHAT, "HALFHAT" },
 		{ XARRAY, "XARRAY" },
@@ -703,7 +711,9 @@ set_IGNORECASE()
 	load_casetable();
 	if (do_traditional)
 		IGNORECASE = false;
-	else if ((n->flags & (STRING|STRCUR)) != 0) {
+	else if ((n->flags & (STRING|STRCUR)) != 0
+			&& (n->flags & (STRING|NUMBER)) != NUMBER) {
+		/* a number that merely has its string value computed is a number */
 		if ((n->flags & MAYBE_NUM) == 0) {
 			(void) force_string(n);
 			IGNORECASE = (n->stlen > 0);
@@ -919,7 +929,8 @@ set_LINT()
 	int old_lint = do_lint;
 	NODE *n = LINT_node->var_value;
 
-	if ((n->flags & (STRING|STRCUR)) != 0) {
+	if ((n->flags & (STRING|STRCUR)) != 0
+			&& (n->flags & (STRING|NUMBER)) != NUMBER) {
 		if ((n->flags & MAYBE_NUM) == 0) {
 			const char *lintval;
 			size_t lintlen;
@@ -1048,7 +1059,7 @@ update_NF()
 	l = get_number_si(NF_node->var_value);
 	if (NF == -1 || l != NF) {
 		if (NF == -1)
-			(void) get_field(UNLIMITED - 1, NULL); /* parse record */
+			count_NF();	/* parse record */
 		unref(NF_node->var_value);
 		NF_node->var_value = make_number(NF);
 	}
@@ -1219,6 +1230,44 @@ calc_exp(AWKNUM x1, AWKNUM x2)
 }
 
 
+/*
+ * Parameter arrays of released frames, kept on per-size free lists so
+ * that steady-state calls to user-defined functions (including the
+ * comparison functions called by asort() and friends) do not go
+ * through malloc.  The first slot of a free array links to the next one.
+ */
+
+#define MAX_POOLED_PARAMS	16
+
+static NODE **param_pool[MAX_POOLED_PARAMS + 1];
+
+/* get_param_stack --- get a zeroed parameter array for a new frame */
+
+static inline NODE **
+get_param_stack(int pcount)
+{
+	NODE **sp;
+
+	if (pcount <= MAX_POOLED_PARAMS && (sp = param_pool[pcount]) != NULL)
+		param_pool[pcount] = (NODE **) sp[0];
+	else
+		emalloc(sp, NODE **, pcount * sizeof(NODE *), "get_param_stack");
+	memset(sp, 0, pcount * sizeof(NODE *));
+	return sp;
+}
+
+/* free_param_stack --- return a frame's parameter array to the pool */
+
+static inline void
+free_param_stack(NODE **sp, int pcount)
+{
+	if (pcount > 0 && pcount <= MAX_POOLED_PARAMS) {
+		sp[0] = (NODE *) param_pool[pcount];
+		param_pool[pcount] = sp;
+	} else
+		efree(sp);
+}
+
 /* setup_frame --- setup new frame for function call */ 
 
 static INSTRUCTION *
@@ -1236,9 +1285,19 @@ setup_frame(INSTRUCTION *pc)
 	arg_count = (pc + 1)->expr_count;
 
 	/* tail recursion optimization */
-	tail_optimize =  ((pc + 1)->tail_call && do_optimize > 1
+	tail_optimize =  (pc->opcode == Op_func_call
+				&& (pc + 1)->tail_call && do_optimize > 1
 				&& ! do_debug && ! do_profile);
 
+	/*
+	 * The calling frame is reused, so an argument that refers to one
+	 * of its parameters, such as a local array, would be cleared
+	 * before it is bound.  Make a real call for those.
+	 */
+	for (j = 0; tail_optimize && j < arg_count; j++)
+		if (PEEK(j)->type == Node_param_list)
+			tail_optimize = false;
+
 	if (tail_optimize) {
 		/* free local vars of calling frame */
 
@@ -1255,10 +1314,8 @@ setup_frame(INSTRUCTION *pc)
 		}
 		sp = frame_ptr->stack;
 
-	} else if (pcount > 0) {
-		emalloc(sp, NODE **, pcount * sizeof(NODE *), "setup_frame");
-		memset(sp, 0, pcount * sizeof(NODE *));
-	}
+	} else if (pcount > 0)
+		sp = get_param_stack(pcount);
 
 
 	/* check for extra args */ 
@@ -1386,7 +1443,7 @@ restore_frame(NODE *fp)
 	}
 
 	if (frame_ptr->stack != NULL)
-		efree(frame_ptr->stack);
+		free_param_stack(frame_ptr->stack, func->param_cnt);
 	ri = frame_ptr->reti;     /* execution in calling frame
 	                           * resumes from ri->nexti.
 	                           */
@@ -1404,6 +1461,104 @@ restore_frame(NODE *fp)
 }
 
 
+/*
+ * Each Op_indirect_func_call keeps a small cache of the functions it has
+ * called, keyed by the string that named them.  The key nodes are
+ * referenced, so their values can't change; finding the very same node
+ * again, as for `@handler[$1]()', costs no string comparison.
+ */
+
+#define INDIRECT_CACHE_SIZE	8
+
+struct indirect_cache {
+	NODE *name[INDIRECT_CACHE_SIZE];
+	NODE *func[INDIRECT_CACHE_SIZE];
+	/* Op_ext_builtin, for an extension function */
+	INSTRUCTION ext[INDIRECT_CACHE_SIZE][2];
+	int next;	/* entry to replace next */
+};
+
+/* indirect_lookup --- find the function for an indirect call, return its cache entry */
+
+static int
+indirect_lookup(INSTRUCTION *pc, NODE *name)
+{
+	struct indirect_cache *ic = (pc + 1)->call_cache;
+	NODE *f, *n;
+	INSTRUCTION *ip;
+	int i;
+
+	if (ic == NULL) {
+		emalloc(ic, struct indirect_cache *, sizeof(struct indirect_cache), "indirect_lookup");
+		memset(ic, 0, sizeof(struct indirect_cache));
+		(pc + 1)->call_cache = ic;
+	}
+
+	for (i = 0; i < INDIRECT_CACHE_SIZE; i++) {
+		if (ic->name[i] == name)
+			return i;
+	}
+
+	name = force_string(name);
+	for (i = 0; i < INDIRECT_CACHE_SIZE && (n = ic->name[i]) != NULL; i++) {
+		if (n->stlen == name->stlen && memcmp(n->stptr, name->stptr, n->stlen) == 0) {
+			if ((name->flags & STRING) != 0) {
+				/* so that the next call with this node hits at once */
+				unref(n);
+				ic->name[i] = dupnode(name);
+			}
+			return i;
+		}
+	}
+
+	f = NULL;
+	if (name->stlen > 0)
+		f = lookup(name->stptr);
+	if (f == NULL || (f->type != Node_func && f->type != Node_ext_func))
+		fatal(_("function called indirectly through `%s' does not exist"),
+				pc->func_name);
+
+	i = ic->next;
+	ic->next = (i + 1) % INDIRECT_CACHE_SIZE;
+	if (ic->name[i] != NULL)
+		unref(ic->name[i]);
+	/* a number's string value can change with CONVFMT */
+	if ((name->flags & STRING) != 0)
+		ic->name[i] = dupnode(name);
+	else
+		ic->name[i] = make_string(name->stptr, name->stlen);
+	ic->func[i] = f;
+
+	if (f->type == Node_ext_func) {
+		/* what the Op_func_call of a direct call turns into */
+		ip = ic->ext[i];
+		memset(ip, 0, 2 * sizeof(INSTRUCTION));
+		ip->opcode = Op_ext_builtin;
+		ip->source_line = pc->source_line;
+		ip->nexti = pc->nexti;
+		ip->extfunc = f->code_ptr->extfunc;
+		ip->expr_count = (pc + 1)->expr_count;	/* actual argument count */
+		(ip + 1)->func_name = f->vname;
+		(ip + 1)->expr_count = f->code_ptr->expr_count;	/* defined max # of arguments */
+	}
+	return i;
+}
+
+/* free_indirect_cache --- release the cache of an Op_indirect_func_call */
+
+void
+free_indirect_cache(struct indirect_cache *ic)
+{
+	int i;
+
+	for (i = 0; i < INDIRECT_CACHE_SIZE; i++) {
+		if (ic->name[i] != NULL)
+			unref(ic->name[i]);
+	}
+	efree(ic);
+}
+
+
 /* free_arrayfor --- free 'for (var in array)' related data */
 
 static inline void
@@ -1724,6 +1879,96 @@ register_exec_hook(Func_pre_exec preh, Func_post_exec posth)
 }
 
 
+/*
+ * Opcode pair counting, enabled with GAWK_OPCODE_PAIRS=n in the
+ * environment.  Each instruction executed bumps the count for the pair
+ * (previous opcode, this opcode); at the end the n most frequent pairs
+ * are printed to stderr.  This is the data used to choose which
+ * sequences are worth fusing into a single instruction.
+ */
+
+static unsigned long (*op_pairs)[Op_final];
+static OPCODE last_op = Op_illegal;
+static long num_op_pairs;
+
+/* count_op_pair --- pre-exec hook to count adjacent opcodes */
+
+static int
+count_op_pair(INSTRUCTION **pi)
+{
+	OPCODE op = (*pi)->opcode;
+
+	op_pairs[last_op][op]++;
+	last_op = op;
+	return true;
+}
+
+struct op_pair {
+	OPCODE first, second;
+	unsigned long count;
+};
+
+/* pair_compare --- qsort helper, sort by decreasing count */
+
+static int
+pair_compare(const void *l, const void *r)
+{
+	const struct op_pair *lp = (const struct op_pair *) l;
+	const struct op_pair *rp = (const struct op_pair *) r;
+
+	if (lp->count != rp->count)
+		return (lp->count < rp->count ? 1 : -1);
+	if (lp->first != rp->first)
+		return (lp->first > rp->first ? 1 : -1);
+	return (lp->second > rp->second) - (lp->second < rp->second);
+}
+
+/* dump_op_pairs --- print the most frequently executed opcode pairs */
+
+void
+dump_op_pairs()
+{
+	struct op_pair *pairs;
+	size_t i, n = 0;
+	int op1, op2;
+
+	if (op_pairs == NULL)
+		return;
+
+	emalloc(pairs, struct op_pair *, Op_final * Op_final * sizeof(struct op_pair), "dump_op_pairs");
+	for (op1 = Op_illegal; op1 < Op_final; op1++) {
+		for (op2 = Op_illegal; op2 < Op_final; op2++) {
+			if (op_pairs[op1][op2] == 0)
+				continue;
+			pairs[n].first = (OPCODE) op1;
+			pairs[n].second = (OPCODE) op2;
+			pairs[n].count = op_pairs[op1][op2];
+			n++;
+		}
+	}
+	qsort(pairs, n, sizeof(struct op_pair), pair_compare);
+
+	for (i = 0; i < n && i < num_op_pairs; i++)
+		fprintf(stderr, "%12lu  %s %s\n", pairs[i].count,
+			pairs[i].first == Op_illegal ? "-" : opcode2str(pairs[i].first),
+			opcode2str(pairs[i].second));
+	fflush(stderr);
+
+	efree(pairs);
+	efree(op_pairs);
+	op_pairs = NULL;
+}
+
+
+/*
+ * Dispatch instructions through a table of label addresses instead of
+ * the switch, with the GNU C "labels as values" extension.  Define
+ * NO_COMPUTED_GOTO to use the plain switch.
+ */
+#if defined(__GNUC__) && ! defined(NO_COMPUTED_GOTO)
+#define COMPUTED_GOTO 1
+#endif
+
 /* interpreter routine when not debugging */ 
 #include "interpret.h"
 
@@ -1743,6 +1988,14 @@ init_interpret()
 	if ((newval = getenv_long("GAWK_STACKSIZE")) > 0)
 		STACK_SIZE = newval;
 
+	if ((newval = getenv_long("GAWK_OPCODE_PAIRS")) > 0) {
+		num_op_pairs = newval;
+		emalloc(op_pairs, unsigned long (*)[Op_final],
+			Op_final * sizeof(*op_pairs), "init_interpret");
+		memset(op_pairs, 0, Op_final * sizeof(*op_pairs));
+		(void) register_exec_hook(count_op_pair, NULL);
+	}
+
 	emalloc(stack_bottom, STACK_ITEM *, STACK_SIZE * sizeof(STACK_ITEM), "grow_stack");
 	stack_ptr = stack_bottom - 1;
 	stack_top = stack_bottom + STACK_SIZE - 1;
@@ -38,6 +38,25 @@ is_blank(int c)
 
 typedef void (* Setfunc)(long, char *, long, NODE *);
 
+/*
+ * The default and single character field splitters look at the record
+ * 64 bytes at a time when byte_mask() and byte_mask3() are available.
+ * A mask_block holds the separators found in one block; next_blank(),
+ * next_nonblank() and next_fs() move through the record using it.  The
+ * last piece of the record, shorter than a block, is done a byte at a
+ * time, the way it always was.
+ */
+
+struct mask_block {
+	char *base;		/* start of the block, or NULL */
+	uint64_t mask;		/* bit i set if base[i] is a separator */
+};
+
+static char *next_blank(struct mask_block *bb, char *scan, char *end, int nl);
+static char *next_nonblank(struct mask_block *bb, char *scan, char *end, int nl);
+static char *next_fs(struct mask_block *mb, char *scan, char *end, int fschar);
+static long sc_parse_spans(long up_to, char **buf, int len, int fschar, long nf);
+
 static long (*parse_field)(long, char **, int, NODE *,
 			     Regexp *, Setfunc, NODE *, NODE *, bool);
 static void rebuild_record(void);
@@ -55,14 +74,42 @@ static long fw_parse_field(long, char **, int, NODE *,
 			     Regexp *, Setfunc, NODE *, NODE *, bool);
 static long fpat_parse_field(long, char **, int, NODE *,
 			     Regexp *, Setfunc, NODE *, NODE *, bool);
+static long csv_parse_field(long, char **, int, NODE *,
+			     Regexp *, Setfunc, NODE *, NODE *, bool);
+static void csv_mode_warning(void);
 static void set_element(long num, char * str, long len, NODE *arr);
 static void grow_fields_arr(long num);
 static void set_field(long num, char *str, long len, NODE *dummy);
+static long count_fields(char *scan, char *end);
+
+/*
+ * Fields are not copied into nodes as the record is split.  Each parser
+ * calls set_field(), which only notes where the field is in $0; the node
+ * in fields_arr[] is filled in by use_field() the first time get_field()
+ * hands the field out.  A span is current only while its gen matches
+ * field_gen, so starting a new record just bumps field_gen.  The fields
+ * whose nodes were handed out or filled in are kept in used_fields[], and
+ * reset_record() only cleans up those, not all of them up to NF.
+ */
+static struct field_span {
+	char *str;
+	long len;
+	unsigned long gen;	/* span is pending if == field_gen */
+	unsigned long used;	/* field is in used_fields[] if == field_gen */
+} *field_spans;
+static unsigned long field_gen = 1;
+
+static long *used_fields;	/* fields whose nodes may not be clean */
+static long num_used = 0;	/* entries in used_fields[] */
+
+static inline NODE **use_field(long num);
+static inline void clear_field(long num);
 
 static char *parse_extent;	/* marks where to restart parse of record */
 static long parse_high_water = 0; /* field number that we have parsed so far */
 static long nf_high_water = 0;	/* size of fields_arr */
 static bool resave_fs;
+static bool nf_counted;		/* NF is known, but not all fields are parsed */
 static NODE *save_FS;		/* save current value of FS when line is read,
 				 * to be used in deferred parsing
 				 */
@@ -70,6 +117,8 @@ static int *FIELDWIDTHS = NULL;
 
 NODE **fields_arr;		/* array of pointers to the field nodes */
 bool field0_valid;		/* $(>0) has not been changed yet */
+long max_field_ref = 0;		/* highest constant $n in the program */
+bool dyn_field_ref = false;	/* program has a $(expression) */
 int default_FS;			/* true when FS == " " */
 Regexp *FS_re_yes_case = NULL;
 Regexp *FS_re_no_case = NULL;
@@ -85,6 +134,9 @@ void
 init_fields()
 {
 	emalloc(fields_arr, NODE **, sizeof(NODE *), "init_fields");
+	emalloc(field_spans, struct field_span *, sizeof(struct field_span), "init_fields");
+	memset(field_spans, 0, sizeof(struct field_span));
+	emalloc(used_fields, long *, sizeof(long), "init_fields");
 	fields_arr[0] = dupnode(Nnull_string);
 	parse_extent = fields_arr[0]->stptr;
 	save_FS = dupnode(FS_node->var_value);
@@ -104,15 +156,18 @@ grow_fields_arr(long num)
 	NODE *n;
 
 	erealloc(fields_arr, NODE **, (num + 1) * sizeof(NODE *), "grow_fields_arr");
+	erealloc(field_spans, struct field_span *, (num + 1) * sizeof(struct field_span), "grow_fields_arr");
+	erealloc(used_fields, long *, (num + 1) * sizeof(long), "grow_fields_arr");
 	for (t = nf_high_water + 1; t <= num; t++) {
 		getnode(n);
 		*n = *Null_field;
 		fields_arr[t] = n;
+		field_spans[t].gen = field_spans[t].used = 0;
 	}
 	nf_high_water = num;
 }
 
-/* set_field --- set the value of a particular field */
+/* set_field --- note where a particular field is */
 
 /*ARGSUSED*/
 static void
@@ -121,14 +176,56 @@ set_field(long num,
 	long len,
 	NODE *dummy ATTRIBUTE_UNUSED)	/* just to make interface same as set_element */
 {
-	NODE *n;
+	struct field_span *fs;
 
 	if (num > nf_high_water)
 		grow_fields_arr(num);
-	n = fields_arr[num];
-	n->stptr = str;
-	n->stlen = len;
-	n->flags = (STRCUR|STRING|MAYBE_NUM|FIELD);
+	fs = & field_spans[num];
+	fs->str = str;
+	fs->len = len;
+	fs->gen = field_gen;
+}
+
+/* use_field --- fill in fields_arr[num] if need be and remember it is in use */
+
+static inline NODE **
+use_field(long num)
+{
+	struct field_span *fs = & field_spans[num];
+
+	if (fs->gen == field_gen) {
+		NODE *n = fields_arr[num];
+
+		n->stptr = fs->str;
+		n->stlen = fs->len;
+		n->flags = (STRCUR|STRING|MAYBE_NUM|FIELD);
+		fs->gen = 0;
+	}
+	if (fs->used != field_gen && num > 0) {	/* NF == 0 asks for $0 */
+		fs->used = field_gen;
+		used_fields[num_used++] = num;
+	}
+	return & fields_arr[num];
+}
+
+/* clear_field --- make $num an empty field again, reusing its node if we can */
+
+static inline void
+clear_field(long num)
+{
+	NODE *n = fields_arr[num];
+
+	if (n->valref == 1) {
+		if ((n->flags & (MALLOC|STRCUR)) == (MALLOC|STRCUR))
+			efree(n->stptr);
+		mpfr_unset(n);
+		free_wstr(n);
+	} else {
+		unref(n);
+		getnode(n);
+		fields_arr[num] = n;
+	}
+	*n = *Null_field;
 }
 
 /* rebuild_record --- Someone assigned a value to $(something).
@@ -151,11 +248,14 @@ rebuild_record()
 
 	assert(NF != -1);
 
+	if (nf_counted)		/* we need all the fields */
+		(void) get_field(UNLIMITED - 1, NULL);
+
 	tlen = 0;
 	ofs = force_string(OFS_node->var_value);
 	ofslen = ofs->stlen;
 	for (i = NF; i > 0; i--) {
-		tmp = fields_arr[i];
+		tmp = *use_field(i);
 		tmp = force_string(tmp);
 		tlen += tmp->stlen;
 	}
@@ -296,17 +396,20 @@ set_record(const char *buf, int cnt)
 void
 reset_record()
 {
-	int i;
-	NODE *n;
+	long i;
 
 	fields_arr[0] = force_string(fields_arr[0]);
 
 	NF = -1;
-	for (i = 1; i <= parse_high_water; i++) {
-		unref(fields_arr[i]);
-		getnode(n);
-		*n = *Null_field;
-		fields_arr[i] = n;
+	nf_counted = false;
+	for (i = 0; i < num_used; i++)
+		clear_field(used_fields[i]);
+	num_used = 0;
+	/* forget all the spans, and that anything was used */
+	if (++field_gen == 0) {
+		for (i = 1; i <= nf_high_water; i++)
+			field_spans[i].gen = field_spans[i].used = 0;
+		field_gen = 1;
 	}
 
 	parse_high_water = 0;
@@ -329,10 +432,12 @@ set_NF()
 {
 	int i;
 	long nf;
-	NODE *n;
 
 	assert(NF != -1);
 
+	if (nf_counted)
+		(void) get_field(UNLIMITED - 1, NULL);
+
 	(void) force_number(NF_node->var_value);
 	nf = get_number_si(NF_node->var_value); 
 	if (nf < 0)
@@ -343,17 +448,13 @@ set_NF()
 		grow_fields_arr(NF);
 	if (parse_high_water < NF) {
 		for (i = parse_high_water + 1; i >= 0 && i <= NF; i++) {
-			unref(fields_arr[i]);
-			getnode(n);
-			*n = *Null_field;
-			fields_arr[i] = n;
+			field_spans[i].gen = 0;
+			clear_field(i);
 		}
 	} else if (parse_high_water > 0) {
 		for (i = NF + 1; i >= 0 && i <= parse_high_water; i++) {
-			unref(fields_arr[i]);
-			getnode(n);
-			*n = *Null_field;
-			fields_arr[i] = n;
+			field_spans[i].gen = 0;
+			clear_field(i);
 		}
 		parse_high_water = NF;
 	}
@@ -453,6 +554,60 @@ re_parse_field(long up_to,	/* parse only up to this field number */
 	return nf;
 }
 
+/*
+ * next_blank --- return the first blank at or after scan, or end.  Blanks
+ * are space, tab and nl; the caller passes nl as '\t' if newline is not
+ * a separator.  The caller has put a blank at *end as a sentinel.
+ */
+
+static char *
+next_blank(struct mask_block *bb, char *scan, char *end, int nl)
+{
+	uint64_t m;
+
+	for (;;) {
+		if (bb->base != NULL && scan >= bb->base && scan < bb->base + 64) {
+			m = bb->mask & (~ (uint64_t) 0 << (scan - bb->base));
+			if (m != 0)
+				return bb->base + lowest_bit(m);
+			scan = bb->base + 64;
+		}
+		if (end - scan < 64)
+			break;
+		bb->base = scan;
+		bb->mask = byte_mask3(scan, ' ', '\t', nl);
+	}
+
+	while (*scan != ' ' && *scan != '\t' && *scan != nl)
+		scan++;
+	return scan;
+}
+
+/* next_nonblank --- return the first non-blank at or after scan, or end */
+
+static char *
+next_nonblank(struct mask_block *bb, char *scan, char *end, int nl)
+{
+	uint64_t m;
+
+	for (;;) {
+		if (bb->base != NULL && scan >= bb->base && scan < bb->base + 64) {
+			m = ~ bb->mask & (~ (uint64_t) 0 << (scan - bb->base));
+			if (m != 0)
+				return bb->base + lowest_bit(m);
+			scan = bb->base + 64;
+		}
+		if (end - scan < 64)
+			break;
+		bb->base = scan;
+		bb->mask = byte_mask3(scan, ' ', '\t', nl);
+	}
+
+	while (scan < end && (*scan == ' ' || *scan == '\t' || *scan == nl))
+		scan++;
+	return scan;
+}
+
 /*
  * def_parse_field --- default field parsing.
  *
@@ -478,6 +633,7 @@ def_parse_field(long up_to,	/* parse only up to this field number */
 	char *end = scan + len;
 	char sav;
 	char *sep;
+	struct mask_block bb = { NULL, 0 };
 
 	if (up_to == UNLIMITED)
 		nf = 0;
@@ -504,8 +660,11 @@ def_parse_field(long up_to,	/* parse only up to this field number */
 		/*
 		 * special case:  fs is single space, strip leading whitespace 
 		 */
-		while (scan < end && (*scan == ' ' || *scan == '\t' || *scan == '\n'))
-			scan++;
+		if (byte_mask3 != NULL)
+			scan = next_nonblank(& bb, scan, end, '\n');
+		else
+			while (scan < end && (*scan == ' ' || *scan == '\t' || *scan == '\n'))
+				scan++;
 
 		if (sep_arr != NULL && scan > sep)
 			set_element(nf, sep, (long) (scan - sep), sep_arr);
@@ -515,8 +674,11 @@ def_parse_field(long up_to,	/* parse only up to this field number */
 
 		field = scan;
 
-		while (*scan != ' ' && *scan != '\t' && *scan != '\n')
-			scan++;
+		if (byte_mask3 != NULL)
+			scan = next_blank(& bb, scan, end, '\n');
+		else
+			while (*scan != ' ' && *scan != '\t' && *scan != '\n')
+				scan++;
 
 		(*set)(++nf, field, (long)(scan - field), n);
 
@@ -558,6 +720,7 @@ posix_def_parse_field(long up_to,	/* parse only up to this field number */
 	char *field;
 	char *end = scan + len;
 	char sav;
+	struct mask_block bb = { NULL, 0 };
 
 	if (up_to == UNLIMITED)
 		nf = 0;
@@ -583,13 +746,19 @@ posix_def_parse_field(long up_to,	/* parse only up to this field number */
 		/*
 		 * special case:  fs is single space, strip leading whitespace 
 		 */
-		while (scan < end && (*scan == ' ' || *scan == '\t'))
-			scan++;
+		if (byte_mask3 != NULL)
+			scan = next_nonblank(& bb, scan, end, '\t');
+		else
+			while (scan < end && (*scan == ' ' || *scan == '\t'))
+				scan++;
 		if (scan >= end)
 			break;
 		field = scan;
-		while (*scan != ' ' && *scan != '\t')
-			scan++;
+		if (byte_mask3 != NULL)
+			scan = next_blank(& bb, scan, end, '\t');
+		else
+			while (*scan != ' ' && *scan != '\t')
+				scan++;
 		(*set)(++nf, field, (long)(scan - field), n);
 		if (scan == end)
 			break;
@@ -656,6 +825,67 @@ null_parse_field(long up_to,	/* parse only up to this field number */
 	return nf;
 }
 
+/* next_fs --- return the first fschar at or after scan; *end is a sentinel */
+
+static char *
+next_fs(struct mask_block *mb, char *scan, char *end, int fschar)
+{
+	uint64_t m;
+
+	for (;;) {
+		if (mb->base != NULL && scan >= mb->base && scan < mb->base + 64) {
+			m = mb->mask & (~ (uint64_t) 0 << (scan - mb->base));
+			if (m != 0)
+				return mb->base + lowest_bit(m);
+			scan = mb->base + 64;
+		}
+		if (end - scan < 64)
+			break;
+		mb->base = scan;
+		mb->mask = byte_mask(scan, fschar);
+	}
+
+	while (*scan != fschar)
+		scan++;
+	return scan;
+}
+
+/*
+ * sc_parse_spans --- sc_parse_field() for get_field().  Each block's mask
+ * gives the positions of all the separators in it.
+ */
+
+static long
+sc_parse_spans(long up_to, char **buf, int len, int fschar, long nf)
+{
+	char *scan = *buf;
+	char *end = scan + len;
+	char *field, *sep;
+	char sav;
+	struct mask_block mb = { NULL, 0 };
+
+	sav = *end;
+	*end = fschar;	/* sentinel character */
+
+	for (field = scan; nf < up_to; field = scan) {
+		sep = next_fs(& mb, scan, end, fschar);
+		set_field(++nf, field, (long) (sep - field), NULL);
+		scan = sep;
+		if (scan == end)
+			break;
+		scan++;
+		if (scan == end) {	/* FS at end of record */
+			set_field(++nf, field, 0L, NULL);
+			break;
+		}
+	}
+
+	*end = sav;
+
+	*buf = scan;
+	return nf;
+}
+
 /*
  * sc_parse_field --- single character field separator
  *
@@ -680,6 +910,8 @@ sc_parse_field(long up_to,	/* parse only up to this field number */
 	char *field;
 	char *end = scan + len;
 	char sav;
+	struct mask_block mb = { NULL, 0 };
+	bool fast;
 #if MBS_SUPPORT
 	size_t mbclen = 0;
 	mbstate_t mbs;
@@ -697,6 +929,17 @@ sc_parse_field(long up_to,	/* parse only up to this field number */
 	else
 		fschar = fs->stptr[0];
 
+	/*
+	 * Use the vector code to find the separators if there is any, and
+	 * only note where the fields are if we are working for get_field().
+	 */
+	if (byte_mask != NULL && byte_is_char(fschar)) {
+		fast = true;
+		if (set == set_field)
+			return sc_parse_spans(up_to, buf, len, fschar, nf);
+	} else
+		fast = false;
+
 	/* before doing anything save the char at *end */
 	sav = *end;
 	/* because it will be destroyed now: */
@@ -704,6 +947,9 @@ sc_parse_field(long up_to,	/* parse only up to this field number */
 
 	for (; nf < up_to;) {
 		field = scan;
+		if (fast)
+			scan = next_fs(& mb, scan, end, fschar);
+		else
 #if MBS_SUPPORT
 		if (gawk_mb_cur_max > 1) {
 			while (*scan != fschar) {
@@ -738,6 +984,153 @@ sc_parse_field(long up_to,	/* parse only up to this field number */
 	return nf;
 }
 
+/*
+ * csv_parse_field --- parse comma separated values, for --csv.
+ *
+ * A field that starts with a double quote goes on to the closing quote,
+ * and may contain commas, newlines, and doubled quotes, which stand for
+ * one quote.  Anything between the closing quote and the next comma is
+ * kept as is.  Quoted fields are unquoted into a buffer as big as the
+ * text being split, at the same offset the field has in the text; for
+ * get_field() that is the buffer for $0, which stays put until the next
+ * record, so that fields can keep pointing into it.
+ */
+
+static long
+csv_parse_field(long up_to,	/* parse only up to this field number */
+	char **buf,	/* on input: string to parse; on output: point to start next */
+	int len,
+	NODE *fs ATTRIBUTE_UNUSED,
+	Regexp *rp ATTRIBUTE_UNUSED,
+	Setfunc set,	/* routine to set the value of the parsed field */
+	NODE *n,
+	NODE *sep_arr,  /* array of field separators (maybe NULL) */
+	bool in_middle ATTRIBUTE_UNUSED)
+{
+	static char *record_buf = NULL, *split_buf = NULL;
+	static size_t record_size = 0, split_size = 0;
+	char *scan = *buf;
+	long nf = parse_high_water;
+	char *end = scan + len;
+	char *base, *out, *field, *p;
+
+	if (up_to == UNLIMITED)
+		nf = 0;
+	if (len == 0)
+		return nf;
+
+	if (set == set_field) {
+		base = fields_arr[0]->stptr;
+		if (record_size < fields_arr[0]->stlen + 1) {
+			record_size = fields_arr[0]->stlen + 1;
+			erealloc(record_buf, char *, record_size, "csv_parse_field");
+		}
+		out = record_buf;
+	} else {
+		base = scan;
+		if (split_size < (size_t) len + 1) {
+			split_size = len + 1;
+			erealloc(split_buf, char *, split_size, "csv_parse_field");
+		}
+		out = split_buf;
+	}
+
+	while (nf < up_to) {
+		if (*scan != '"') {
+			field = scan;
+			if ((scan = memchr(scan, ',', end - scan)) == NULL)
+				scan = end;
+			(*set)(++nf, field, (long) (scan - field), n);
+		} else {
+			field = p = out + (scan - base);
+			for (scan++; scan < end; scan++) {
+				char *q = memchr(scan, '"', end - scan);
+
+				if (q == NULL)
+					q = end;
+				memcpy(p, scan, q - scan);
+				p += q - scan;
+				scan = q;
+				if (scan + 1 >= end || scan[1] != '"')
+					break;
+				*p++ = '"';	/* "" inside quotes */
+				scan++;
+			}
+			if (scan < end)
+				scan++;		/* closing quote */
+			/* anything else up to the comma */
+			while (scan < end && *scan != ',')
+				*p++ = *scan++;
+			(*set)(++nf, field, (long) (p - field), n);
+		}
+		if (scan == end)
+			break;
+		if (sep_arr != NULL)
+			set_element(nf, scan, 1L, sep_arr);
+		if (++scan == end) {	/* comma at end of record */
+			(*set)(++nf, scan, 0L, n);
+			break;
+		}
+	}
+
+	*buf = scan;
+	return nf;
+}
+
+/*
+ * count_fields --- return how many fields there are from scan to end,
+ * where scan is where get_field() stopped parsing, or -1 if the
+ * current parser can't do that without splitting the fields.
+ */
+
+static long
+count_fields(char *scan, char *end)
+{
+	long n = 0;
+	int fschar;
+	uint64_t b, prev;
+
+	if (parse_field == sc_parse_field) {
+		if (RS_is_null && save_FS->stlen == 0)
+			fschar = '\n';
+		else
+			fschar = save_FS->stptr[0];
+		if (! byte_is_char(fschar))
+			return -1;
+		if (scan == end)
+			return 0;
+		/* one more field than there are separators */
+		if (byte_mask != NULL)
+			for (; end - scan >= 64; scan += 64)
+				n += count_bits(byte_mask(scan, fschar));
+		for (; scan < end; scan++)
+			if (*scan == fschar)
+				n++;
+		return n + 1;
+	} else if ((parse_field == def_parse_field
+			|| parse_field == posix_def_parse_field)
+		   && save_FS->stlen != 0) {
+		int nl = (parse_field == def_parse_field ? '\n' : '\t');
+
+		/* count the blanks followed by something else */
+		prev = 1;	/* scan follows a blank, or starts $0 */
+		if (byte_mask3 != NULL)
+			for (; end - scan >= 64; scan += 64) {
+				b = byte_mask3(scan, ' ', '\t', nl);
+				n += count_bits(~ b & (b << 1 | prev));
+				prev = b >> 63;
+			}
+		for (; scan < end; scan++) {
+			b = (*scan == ' ' || *scan == '\t' || *scan == nl);
+			if (! b && prev)
+				n++;
+			prev = b;
+		}
+		return n;
+	}
+	return -1;
+}
+
 /*
  * fw_parse_field --- field parsing using FIELDWIDTHS spec
  *
@@ -822,6 +1215,41 @@ invalidate_field0()
 	field0_valid = false;
 }
 
+/*
+ * count_NF --- find NF for the current record.  If the program has no
+ * $(expression), the fields after the highest constant $n can only be
+ * needed to rebuild $0 or to change NF, so just count them; they get
+ * parsed if either of those happens.
+ */
+
+void
+count_NF()
+{
+	char *end;
+	long n;
+
+	if (NF != -1)
+		return;
+	if (dyn_field_ref) {
+		(void) get_field(UNLIMITED - 1, NULL);
+		return;
+	}
+	if (max_field_ref > parse_high_water)
+		(void) get_field(max_field_ref, NULL);
+	if (NF != -1)	/* got to the end of the record */
+		return;
+
+	if (parse_high_water == 0)
+		parse_extent = fields_arr[0]->stptr;
+	end = fields_arr[0]->stptr + fields_arr[0]->stlen;
+	if ((n = count_fields(parse_extent, end)) < 0) {
+		(void) get_field(UNLIMITED - 1, NULL);
+		return;
+	}
+	NF = parse_high_water + n;
+	nf_counted = true;
+}
+
 /* get_field --- return a particular $n */
 
 /* assign is not NULL if this field is on the LHS of an assign */
@@ -872,10 +1300,11 @@ get_field(long requested, Func_ptr *assign)
 		*assign = invalidate_field0;	/* $0 needs reconstruction */
 #endif
 
-	if (requested <= parse_high_water)	/* already parsed this field */
-		return &fields_arr[requested];
+	if (requested <= parse_high_water) {	/* already parsed this field */
+		return use_field(requested);
+	}
 
-	if (NF == -1) {	/* have not yet parsed to end of record */
+	if (NF == -1 || nf_counted) {	/* have not yet parsed to end of record */
 		/*
 		 * parse up to requested fields, calling set_field() for each,
 		 * saving in parse_extent the point where the parse left off
@@ -896,9 +1325,10 @@ get_field(long requested, Func_ptr *assign)
 		 * reference to the field and NF only gets set if the field
 		 * is assigned to -- this case is handled below
 		 */
-		if (parse_extent == fields_arr[0]->stptr + fields_arr[0]->stlen)
+		if (parse_extent == fields_arr[0]->stptr + fields_arr[0]->stlen) {
 			NF = parse_high_water;
-		else if (parse_field == fpat_parse_field) {
+			nf_counted = false;
+		} else if (parse_field == fpat_parse_field) {
 			/* FPAT parsing is wierd, isolate the special cases */
 			char *rec_start = fields_arr[0]->stptr;
 			char *rec_end = fields_arr[0]->stptr + fields_arr[0]->stlen;
@@ -923,7 +1353,7 @@ get_field(long requested, Func_ptr *assign)
 			return &Null_field;
 	}
 
-	return &fields_arr[requested];
+	return use_field(requested);
 }
 
 /* set_element --- set an array element, used by do_split() */
@@ -1123,6 +1553,10 @@ set_FIELDWIDTHS()
 	}
 	if (do_traditional)	/* quick and dirty, does the trick */
 		return;
+	if (do_csv) {
+		csv_mode_warning();
+		return;
+	}
 
 	/*
 	 * If changing the way fields are split, obey least-suprise
@@ -1317,9 +1751,28 @@ choose_fs_function:
 	if (fs->stlen == 1 && parse_field == re_parse_field)
 		FS_regexp = FS_re_yes_case;
 
+	if (do_csv) {
+		if (fs->stlen != 1 || fs->stptr[0] != ' ')
+			csv_mode_warning();
+		parse_field = csv_parse_field;
+	}
+
 	update_PROCINFO_str("FS", "FS");
 }
 
+/* csv_mode_warning --- FS, FIELDWIDTHS and FPAT don't apply with --csv */
+
+static void
+csv_mode_warning()
+{
+	static bool warned = false;
+
+	if (! warned) {
+		warned = true;
+		warning(_("assignment to FS/FIELDWIDTHS/FPAT has no effect when using --csv"));
+	}
+}
+
 /* current_field_sep --- return what field separator is */
 
 field_sep_type
@@ -1383,6 +1836,10 @@ set_FPAT()
 	}
 	if (do_traditional)	/* quick and dirty, does the trick */
 		return;
+	if (do_csv) {
+		csv_mode_warning();
+		return;
+	}
 
 	/*
 	 * If changing the way fields are split, obey least-suprise
@@ -1427,6 +1884,7 @@ set_fpat_function:
 		FPAT_re_yes_case = FPAT_re_no_case = FPAT_regexp = NULL;
 
 		FPAT_re_yes_case = make_regexp(fpat->stptr, fpat->stlen, false, true, true);
+		make_scanner(FPAT_re_yes_case, fpat->stptr, fpat->stlen);
 		FPAT_re_no_case = make_regexp(fpat->stptr, fpat->stlen, true, true, true);
 		FPAT_regexp = (IGNORECASE ? FPAT_re_no_case : FPAT_re_yes_case);
 	}
@@ -1468,6 +1926,29 @@ incr_scan(char **scanp, size_t len, mbstate_t *mbs)
 }
 #endif
 
+/*
+ * fpat_match --- find the next field.  Use FPAT's scanner while
+ * *use_scanner is true, otherwise the regex routines.  Return the start,
+ * and the end in *endp.  If the scanner gives up, it isn't used again
+ * for the rest of the record.
+ */
+
+static inline int
+fpat_match(Regexp *rp, bool *use_scanner, char *scan, size_t len,
+		int regex_flags, size_t *endp)
+{
+	int start;
+
+	if (*use_scanner) {
+		if ((start = scan_regexp(rp, scan, len, endp)) != -2)
+			return start;
+		*use_scanner = false;
+	}
+	if ((start = research(rp, scan, 0, len, regex_flags)) != -1)
+		*endp = REEND(rp, scan);
+	return start;
+}
+
 /*
  * fpat_parse_field --- parse fields using a regexp.
  *
@@ -1591,6 +2072,9 @@ fpat_parse_field(long up_to,	/* parse only up to this field number */
 	bool need_to_set_sep;
 	bool non_empty;
 	bool eosflag;
+	bool use_scanner;
+	int mstart;
+	size_t mend;
 #if MBS_SUPPORT
 	mbstate_t mbs;
 
@@ -1607,6 +2091,8 @@ fpat_parse_field(long up_to,	/* parse only up to this field number */
 	if (rp == NULL) /* use FPAT */
 		rp = FPAT_regexp;
 
+	use_scanner = scanner_useful(rp, scan, len);
+
 	if (in_middle) {
 		regex_flags |= RE_NO_BOL;
 		non_empty = rp->non_empty;
@@ -1616,27 +2102,28 @@ fpat_parse_field(long up_to,	/* parse only up to this field number */
 	eosflag = false;
 	need_to_set_sep = true;
 	start = scan;
-	while (research(rp, scan, 0, (end - scan), regex_flags) != -1
+	while ((mstart = fpat_match(rp, & use_scanner, scan, end - scan,
+				regex_flags, & mend)) != -1
 	       && nf < up_to) {
 
-		if (REEND(rp, scan) > RESTART(rp, scan)) { /* if (RLENGTH > 0) */
+		if (mend > mstart) { /* if (RLENGTH > 0) */
 			non_empty = true;
 			if (sep_arr != NULL && need_to_set_sep) {
-				if (RESTART(rp, scan) == 0) /* match at front */
+				if (mstart == 0) /* match at front */
 		    			set_element(nf, start, 0L, sep_arr);
 				else
 		    			set_element(nf,
 						start,
-						(long) RESTART(rp, scan),
+						(long) mstart,
 						sep_arr);
 			}
 			/* field is text that matched */
 			(*set)(++nf,
-				scan + RESTART(rp, scan),
-				(long)(REEND(rp, scan) - RESTART(rp, scan)),
+				scan + mstart,
+				(long)(mend - mstart),
 				n);
 
-			scan += REEND(rp, scan);
+			scan += mend;
 			if (scan >= end)
 				break;
 			need_to_set_sep = true;
@@ -1655,11 +2142,11 @@ fpat_parse_field(long up_to,	/* parse only up to this field number */
 		} else {
 			/* 0 length match */
 			if (sep_arr != NULL && need_to_set_sep) {
-				if (RESTART(rp, scan) == 0) /* RSTART == 1 */
+				if (mstart == 0) /* RSTART == 1 */
 		    			set_element(nf, start, 0L, sep_arr);
 				else
 		    			set_element(nf, start,
-							(long) RESTART(rp, scan),
+							(long) mstart,
 							sep_arr);
 			}
 			need_to_set_sep = true;
@@ -1670,10 +2157,10 @@ fpat_parse_field(long up_to,	/* parse only up to this field number */
 					need_to_set_sep = false;
 				}
 			}
-			if (RESTART(rp, scan) == 0)
+			if (mstart == 0)
 				increment_scan(& scan, end - scan);
 			else {
-				scan += RESTART(rp, scan);
+				scan += mstart;
 			}
 			non_empty = false;
 		}
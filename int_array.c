@@ -492,7 +492,7 @@ int_list(NODE *symbol, NODE *t)
 					subs->numbr = num;
 					subs->flags |= (NUMCUR|NUMINT);
 				} else {
-					subs = make_number((AWKNUM) num);
+					subs = make_unshared_number((AWKNUM) num);
 					subs->flags |= (INTIND|NUMINT);
 				}
 				list[k++] = subs;
@@ -628,7 +628,7 @@ int_dump(NODE *symbol, NODE *ndump)
 		fprintf(output_fp, "\n");
 
 		aname = make_aname(symbol);
-		subs = make_number((AWKNUM) 0);
+		subs = make_unshared_number((AWKNUM) 0);
 		subs->flags |= (INTIND|NUMINT);
 
 		for (i = 0; i < symbol->array_size; i++) {
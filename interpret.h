@@ -38,11 +38,160 @@ r_interpret(INSTRUCTION *code)
 	int di;
 	Regexp *rp;
 
+#ifdef COMPUTED_GOTO
+	/*
+	 * Where the code for each opcode starts.  Opcodes that have no
+	 * code of their own go to L_default.  KEEP IN SYNC WITH awk.h!!!!
+	 */
+	static const void *const op_labels[Op_final] = {
+		[Op_illegal] = && L_default,
+		[Op_times] = && L_Op_times,
+		[Op_times_i] = && L_Op_times_i,
+		[Op_quotient] = && L_Op_quotient,
+		[Op_quotient_i] = && L_Op_quotient_i,
+		[Op_mod] = && L_Op_mod,
+		[Op_mod_i] = && L_Op_mod_i,
+		[Op_plus] = && L_Op_plus,
+		[Op_plus_i] = && L_Op_plus_i,
+		[Op_minus] = && L_Op_minus,
+		[Op_minus_i] = && L_Op_minus_i,
+		[Op_exp] = && L_Op_exp,
+		[Op_exp_i] = && L_Op_exp_i,
+		[Op_concat] = && L_Op_concat,
+		[Op_line_range] = && L_Op_line_range,
+		[Op_cond_pair] = && L_Op_cond_pair,
+		[Op_subscript] = && L_Op_subscript,
+		[Op_sub_array] = && L_Op_sub_array,
+		[Op_preincrement] = && L_Op_preincrement,
+		[Op_predecrement] = && L_Op_predecrement,
+		[Op_postincrement] = && L_Op_postincrement,
+		[Op_postdecrement] = && L_Op_postdecrement,
+		[Op_unary_minus] = && L_Op_unary_minus,
+		[Op_field_spec] = && L_Op_field_spec,
+		[Op_field_spec_i] = && L_Op_field_spec_i,
+		[Op_not] = && L_Op_not,
+		[Op_assign] = && L_Op_assign,
+		[Op_store_var] = && L_Op_store_var,
+		[Op_store_sub] = && L_Op_store_sub,
+		[Op_store_field] = && L_Op_store_field,
+		[Op_store_plus] = && L_Op_store_plus,
+		[Op_store_sub_plus] = && L_Op_store_sub_plus,
+		[Op_assign_times] = && L_Op_assign_times,
+		[Op_assign_quotient] = && L_Op_assign_quotient,
+		[Op_assign_mod] = && L_Op_assign_mod,
+		[Op_assign_plus] = && L_Op_assign_plus,
+		[Op_assign_minus] = && L_Op_assign_minus,
+		[Op_assign_exp] = && L_Op_assign_exp,
+		[Op_assign_concat] = && L_Op_assign_concat,
+		[Op_and] = && L_Op_and,
+		[Op_and_final] = && L_Op_and_final,
+		[Op_or] = && L_Op_or,
+		[Op_or_final] = && L_Op_or_final,
+		[Op_equal] = && L_Op_equal,
+		[Op_equal_i] = && L_Op_equal_i,
+		[Op_notequal] = && L_Op_notequal,
+		[Op_notequal_i] = && L_Op_notequal_i,
+		[Op_less] = && L_Op_less,
+		[Op_greater] = && L_Op_greater,
+		[Op_leq] = && L_Op_leq,
+		[Op_geq] = && L_Op_geq,
+		[Op_match] = && L_Op_match,
+		[Op_match_rec] = && L_Op_match_rec,
+		[Op_nomatch] = && L_Op_nomatch,
+		[Op_rule] = && L_Op_rule,
+		[Op_K_case] = && L_Op_K_case,
+		[Op_K_default] = && L_Op_K_default,
+		[Op_K_break] = && L_Op_K_break,
+		[Op_K_continue] = && L_Op_K_continue,
+		[Op_K_print] = && L_Op_K_print,
+		[Op_K_print_rec] = && L_Op_K_print_rec,
+		[Op_K_printf] = && L_Op_K_printf,
+		[Op_K_next] = && L_Op_K_next,
+		[Op_K_exit] = && L_Op_K_exit,
+		[Op_K_return] = && L_Op_K_return,
+		[Op_K_delete] = && L_Op_K_delete,
+		[Op_K_delete_loop] = && L_Op_K_delete_loop,
+		[Op_K_getline_redir] = && L_Op_K_getline_redir,
+		[Op_K_getline] = && L_Op_K_getline,
+		[Op_K_nextfile] = && L_Op_K_nextfile,
+		[Op_builtin] = && L_Op_builtin,
+		[Op_sub_builtin] = && L_Op_sub_builtin,
+		[Op_ext_builtin] = && L_Op_ext_builtin,
+		[Op_in_array] = && L_Op_in_array,
+		[Op_func_call] = && L_Op_func_call,
+		[Op_indirect_func_call] = && L_Op_indirect_func_call,
+		[Op_inline_enter] = && L_Op_inline_enter,
+		[Op_inline_leave] = && L_Op_inline_leave,
+		[Op_push] = && L_Op_push,
+		[Op_push_arg] = && L_Op_push_arg,
+		[Op_push_i] = && L_Op_push_i,
+		[Op_push_re] = && L_Op_push_re,
+		[Op_push_array] = && L_Op_push_array,
+		[Op_push_param] = && L_Op_push_param,
+		[Op_push_lhs] = && L_Op_push_lhs,
+		[Op_subscript_lhs] = && L_Op_subscript_lhs,
+		[Op_field_spec_lhs] = && L_Op_field_spec_lhs,
+		[Op_no_op] = && L_Op_no_op,
+		[Op_pop] = && L_Op_pop,
+		[Op_jmp] = && L_Op_jmp,
+		[Op_jmp_true] = && L_Op_jmp_true,
+		[Op_jmp_false] = && L_Op_jmp_false,
+		[Op_get_record] = && L_Op_get_record,
+		[Op_newfile] = && L_Op_newfile,
+		[Op_arrayfor_init] = && L_Op_arrayfor_init,
+		[Op_arrayfor_incr] = && L_Op_arrayfor_incr,
+		[Op_arrayfor_final] = && L_Op_arrayfor_final,
+		[Op_var_update] = && L_Op_var_update,
+		[Op_var_assign] = && L_Op_var_assign,
+		[Op_field_assign] = && L_Op_field_assign,
+		[Op_after_beginfile] = && L_Op_after_beginfile,
+		[Op_after_endfile] = && L_Op_after_endfile,
+		[Op_func] = && L_Op_func,
+		[Op_exec_count] = && L_Op_exec_count,
+		[Op_breakpoint] = && L_default,
+		[Op_lint] = && L_Op_lint,
+		[Op_atexit] = && L_Op_atexit,
+		[Op_stop] = && L_Op_stop,
+		[Op_token] = && L_default,
+		[Op_symbol] = && L_default,
+		[Op_list] = && L_default,
+		[Op_K_do] = && L_Op_K_do,
+		[Op_K_for] = && L_Op_K_for,
+		[Op_K_arrayfor] = && L_Op_K_arrayfor,
+		[Op_K_while] = && L_Op_K_while,
+		[Op_K_switch] = && L_Op_K_switch,
+		[Op_K_if] = && L_Op_K_if,
+		[Op_K_else] = && L_Op_K_else,
+		[Op_K_function] = && L_default,
+		[Op_cond_exp] = && L_Op_cond_exp,
+	};
+#endif
+
 /* array subscript */
 #define mk_sub(n)  	(n == 1 ? POP_SCALAR() : concat_exp(n, true))
 
+/*
+ * Each case also gets a label, so that with COMPUTED_GOTO an instruction
+ * can jump straight to the code for the next one, without the bounds
+ * check and the single, hard to predict, indirect branch of the switch.
+ */
+#ifdef COMPUTED_GOTO
+#define OPCASE(x)	case x: L_##x
+#define OPDEFAULT	default: L_default
+#else
+#define OPCASE(x)	case x
+#define OPDEFAULT	default
+#endif
+
 #ifdef EXEC_HOOK
 #define JUMPTO(x)	do { if (post_execute) post_execute(pc); pc = (x); goto top; } while (false)
+#elif defined(COMPUTED_GOTO)
+#define JUMPTO(x)	do { \
+				pc = (x); \
+				if (pc->source_line > 0) \
+					sourceline = pc->source_line; \
+				goto *op_labels[op = pc->opcode]; \
+			} while (false)
 #else
 #define JUMPTO(x)	do { pc = (x); goto top; } while (false)
 #endif
@@ -58,7 +207,9 @@ r_interpret(INSTRUCTION *code)
 	/* loop until hit Op_stop instruction */
 
 	/* forever {  */
+#if ! defined(COMPUTED_GOTO) || defined(EXEC_HOOK)
 top:
+#endif
 		if (pc->source_line > 0)
 			sourceline = pc->source_line;
 
@@ -69,15 +220,18 @@ top:
 		}
 #endif
 
+#ifdef COMPUTED_GOTO
+		goto *op_labels[op = pc->opcode];
+#endif
 		switch ((op = pc->opcode)) {
-		case Op_rule:
+		OPCASE(Op_rule):
 			currule = pc->in_rule;   /* for sole use in Op_K_next, Op_K_nextfile, Op_K_getline */
 			/* fall through */
-		case Op_func:
+		OPCASE(Op_func):
 			source = pc->source_file;
 			break;
 
-		case Op_atexit:
+		OPCASE(Op_atexit):
 		{
 			bool stdio_problem = false;
 
@@ -106,10 +260,10 @@ top:
 		}
 			break;
 
-		case Op_stop:
+		OPCASE(Op_stop):
 			return 0;
 
-		case Op_push_i:
+		OPCASE(Op_push_i):
 			m = pc->memory;
 			if (! do_traditional && (m->flags & INTLSTR) != 0) {
 				char *orig, *trans, save;
@@ -125,8 +279,8 @@ top:
 			PUSH(m);
 			break;
 
-		case Op_push:
-		case Op_push_arg:
+		OPCASE(Op_push):
+		OPCASE(Op_push_arg):
 		{
 			NODE *save_symbol;
 			bool isparam = false;
@@ -177,7 +331,7 @@ top:
 		}
 			break;	
 
-		case Op_push_param:		/* function argument */
+		OPCASE(Op_push_param):		/* function argument */
 			m = pc->memory;
 			if (m->type == Node_param_list)
 				m = GET_PARAM(m->param_cnt);
@@ -189,16 +343,16 @@ top:
 			}
  			/* else
 				fall through */
-		case Op_push_array:
+		OPCASE(Op_push_array):
 			PUSH(pc->memory);
 			break;
 
-		case Op_push_lhs:
+		OPCASE(Op_push_lhs):
 			lhs = get_lhs(pc->memory, pc->do_reference);
 			PUSH_ADDRESS(lhs);
 			break;
 
-		case Op_subscript:
+		OPCASE(Op_subscript):
 			t2 = mk_sub(pc->sub_count);
 			t1 = POP_ARRAY();
 
@@ -241,7 +395,7 @@ top:
 			PUSH(r);
 			break;
 
-		case Op_sub_array:
+		OPCASE(Op_sub_array):
 			t2 = mk_sub(pc->sub_count);
 			t1 = POP_ARRAY();
 			r = in_array(t1, t2);
@@ -261,7 +415,7 @@ top:
 			PUSH(r);
 			break;
 
-		case Op_subscript_lhs:
+		OPCASE(Op_subscript_lhs):
 			t2 = mk_sub(pc->sub_count);
 			t1 = POP_ARRAY();
 			if (do_lint && in_array(t1, t2) == NULL) {
@@ -284,7 +438,7 @@ top:
 			PUSH_ADDRESS(lhs);
 			break;
 
-		case Op_field_spec:
+		OPCASE(Op_field_spec):
 			t1 = TOP_SCALAR();
 			lhs = r_get_field(t1, (Func_ptr *) 0, true);
 			decr_sp();
@@ -293,7 +447,14 @@ top:
 			PUSH(r);
 			break;
 
-		case Op_field_spec_lhs:
+		OPCASE(Op_field_spec_i):
+			/* $n for a constant n, see awkgram.y (fuse_field_refs) */
+			lhs = r_get_field(pc->memory, (Func_ptr *) 0, true);
+			r = dupnode(*lhs);     /* can't use UPREF here */
+			PUSH(r);
+			break;
+
+		OPCASE(Op_field_spec_lhs):
 			t1 = TOP_SCALAR();
 			lhs = r_get_field(t1, &pc->target_assign->field_assign, pc->do_reference);
 			decr_sp();
@@ -301,7 +462,7 @@ top:
 			PUSH_ADDRESS(lhs);
 			break;
 
-		case Op_lint:
+		OPCASE(Op_lint):
 			if (do_lint) {
 				switch (pc->lint_type) {
 				case LINT_assign_in_cond:
@@ -318,13 +479,13 @@ top:
 			}
 			break;
 
-		case Op_K_break:
-		case Op_K_continue:
-		case Op_jmp:
+		OPCASE(Op_K_break):
+		OPCASE(Op_K_continue):
+		OPCASE(Op_jmp):
 			assert(pc->target_jmp != NULL);
 			JUMPTO(pc->target_jmp);
 
-		case Op_jmp_false:
+		OPCASE(Op_jmp_false):
 			r = POP_SCALAR();
 			di = eval_condition(r);
 			DEREF(r);
@@ -332,7 +493,7 @@ top:
 				JUMPTO(pc->target_jmp);
 			break;
 
-		case Op_jmp_true:
+		OPCASE(Op_jmp_true):
 			r = POP_SCALAR();
 			di = eval_condition(r);
 			DEREF(r);			
@@ -340,8 +501,8 @@ top:
 				JUMPTO(pc->target_jmp);
 			break;
 
-		case Op_and:
-		case Op_or:
+		OPCASE(Op_and):
+		OPCASE(Op_or):
 			t1 = POP_SCALAR();
 			di = eval_condition(t1);
 			DEREF(t1);
@@ -353,8 +514,8 @@ top:
 			ni = pc->target_jmp;
 			JUMPTO(ni->nexti);
 
-		case Op_and_final:
-		case Op_or_final:
+		OPCASE(Op_and_final):
+		OPCASE(Op_or_final):
 			t1 = TOP_SCALAR();
 			r = node_Boolean[eval_condition(t1)];
 			DEREF(t1);
@@ -362,7 +523,7 @@ top:
 			REPLACE(r);
 			break;
 
-		case Op_not:
+		OPCASE(Op_not):
 			t1 = TOP_SCALAR();
 			r = node_Boolean[! eval_condition(t1)];
 			DEREF(t1);
@@ -370,102 +531,104 @@ top:
 			REPLACE(r);
 			break;
 
-		case Op_equal:
+		OPCASE(Op_equal):
 			r = node_Boolean[cmp_scalars() == 0];
 			UPREF(r);
 			REPLACE(r);
 			break;
 
-		case Op_notequal:
+		OPCASE(Op_notequal):
 			r = node_Boolean[cmp_scalars() != 0];
 			UPREF(r);
 			REPLACE(r);
 			break;
 
-		case Op_less:
+		OPCASE(Op_equal_i):
+		OPCASE(Op_notequal_i):
+			t1 = TOP_SCALAR();
+			di = cmp_nodes(t1, pc->memory);
+			DEREF(t1);
+			r = node_Boolean[(di == 0) == (op == Op_equal_i)];
+			UPREF(r);
+			REPLACE(r);
+			break;
+
+		OPCASE(Op_less):
 			r = node_Boolean[cmp_scalars() < 0];
 			UPREF(r);
 			REPLACE(r);
 			break;
 
-		case Op_greater:
+		OPCASE(Op_greater):
 			r = node_Boolean[cmp_scalars() > 0];
 			UPREF(r);
 			REPLACE(r);
 			break;
 
-		case Op_leq:
+		OPCASE(Op_leq):
 			r = node_Boolean[cmp_scalars() <= 0];
 			UPREF(r);
 			REPLACE(r);
 			break;
 
-		case Op_geq:
+		OPCASE(Op_geq):
 			r = node_Boolean[cmp_scalars() >= 0];
 			UPREF(r);
 			REPLACE(r);
 			break;
 
-		case Op_plus_i:
+		OPCASE(Op_plus_i):
 			x2 = force_number(pc->memory)->numbr;
 			goto plus;
-		case Op_plus:
+		OPCASE(Op_plus):
 			t2 = POP_NUMBER();
 			x2 = t2->numbr;
 			DEREF(t2);
 plus:
 			t1 = TOP_NUMBER();
-			r = make_number(t1->numbr + x2);
-			DEREF(t1);
-			REPLACE(r);
+			REPLACE_NUMBER(t1, t1->numbr + x2);
 			break;
 
-		case Op_minus_i:
+		OPCASE(Op_minus_i):
 			x2 = force_number(pc->memory)->numbr;
 			goto minus;
-		case Op_minus:
+		OPCASE(Op_minus):
 			t2 = POP_NUMBER();
 			x2 = t2->numbr;
 			DEREF(t2);			
 minus:
 			t1 = TOP_NUMBER();
-			r = make_number(t1->numbr - x2);
-			DEREF(t1);
-			REPLACE(r);
+			REPLACE_NUMBER(t1, t1->numbr - x2);
 			break;
 
-		case Op_times_i:
+		OPCASE(Op_times_i):
 			x2 = force_number(pc->memory)->numbr;
 			goto times;
-		case Op_times:
+		OPCASE(Op_times):
 			t2 = POP_NUMBER();
 			x2 = t2->numbr;
 			DEREF(t2);
 times:
 			t1 = TOP_NUMBER();
-			r = make_number(t1->numbr * x2);
-			DEREF(t1);
-			REPLACE(r);
+			REPLACE_NUMBER(t1, t1->numbr * x2);
 			break;
 
-		case Op_exp_i:
+		OPCASE(Op_exp_i):
 			x2 = force_number(pc->memory)->numbr;
 			goto exp;
-		case Op_exp:
+		OPCASE(Op_exp):
 			t2 = POP_NUMBER();
 			x2 = t2->numbr;
 			DEREF(t2);
 exp:
 			t1 = TOP_NUMBER();
-			r = make_number(calc_exp(t1->numbr, x2));
-			DEREF(t1);
-			REPLACE(r);
+			REPLACE_NUMBER(t1, calc_exp(t1->numbr, x2));
 			break;
 
-		case Op_quotient_i:
+		OPCASE(Op_quotient_i):
 			x2 = force_number(pc->memory)->numbr;
 			goto quotient;
-		case Op_quotient:
+		OPCASE(Op_quotient):
 			t2 = POP_NUMBER();
 			x2 = t2->numbr;
 			DEREF(t2);
@@ -473,15 +636,13 @@ quotient:
 			t1 = TOP_NUMBER();
 			if (x2 == 0)
 				fatal(_("division by zero attempted"));
-			r = make_number(t1->numbr / x2);
-			DEREF(t1);
-			REPLACE(r);
-			break;		
+			REPLACE_NUMBER(t1, t1->numbr / x2);
+			break;
 
-		case Op_mod_i:
+		OPCASE(Op_mod_i):
 			x2 = force_number(pc->memory)->numbr;
 			goto mod;
-		case Op_mod:
+		OPCASE(Op_mod):
 			t2 = POP_NUMBER();
 			x2 = t2->numbr;
 			DEREF(t2);
@@ -495,14 +656,11 @@ mod:
 			(void) modf(t1->numbr / x2, &x);
 			x = t1->numbr - x * x2;
 #endif	/* ! HAVE_FMOD */
-			r = make_number(x);
-
-			DEREF(t1);
-			REPLACE(r);
+			REPLACE_NUMBER(t1, x);
 			break;
 
-		case Op_preincrement:
-		case Op_predecrement:
+		OPCASE(Op_preincrement):
+		OPCASE(Op_predecrement):
 			x = op == Op_preincrement ? 1.0 : -1.0;
 			lhs = TOP_ADDRESS();
 			t1 = *lhs;
@@ -519,8 +677,8 @@ mod:
 			REPLACE(r);
 			break;
 
-		case Op_postincrement:
-		case Op_postdecrement:
+		OPCASE(Op_postincrement):
+		OPCASE(Op_postdecrement):
 			x = op == Op_postincrement ? 1.0 : -1.0;
 			lhs = TOP_ADDRESS();
 			t1 = *lhs;
@@ -536,14 +694,12 @@ mod:
 			REPLACE(r);
 			break;
 
-		case Op_unary_minus:
+		OPCASE(Op_unary_minus):
 			t1 = TOP_NUMBER();
-			r = make_number(-t1->numbr);
-			DEREF(t1);
-			REPLACE(r);
+			REPLACE_NUMBER(t1, -t1->numbr);
 			break;
 
-		case Op_store_sub:
+		OPCASE(Op_store_sub):
 			/* array[sub] assignment optimization,
 			 * see awkgram.y (optimize_assignment)
 			 */
@@ -582,7 +738,7 @@ mod:
 			*lhs = POP_SCALAR();
 			break;
 
-		case Op_store_var:
+		OPCASE(Op_store_var):
 			/* simple variable assignment optimization,
 			 * see awkgram.y (optimize_assignment)
 			 */
@@ -598,7 +754,7 @@ mod:
 			}
 			break;
 
-		case Op_store_field:
+		OPCASE(Op_store_field):
 		{
 			/* field assignment optimization,
 			 * see awkgram.y (optimize_assignment)
@@ -616,7 +772,53 @@ mod:
 		}
 			break;
 
-		case Op_assign_concat:
+		OPCASE(Op_store_plus):
+			/* var += x, var++ and so on as a statement,
+			 * see awkgram.y (optimize_plus_assign)
+			 */
+			lhs = get_lhs(pc->memory, true);
+			goto store_plus;
+
+		OPCASE(Op_store_sub_plus):
+			/* array[sub] += x, array[sub]++ and so on as a statement,
+			 * see awkgram.y (optimize_plus_assign)
+			 */
+			t1 = get_array(pc->memory, true);	/* array */
+			t2 = POP_SCALAR();			/* subscript */
+			if (do_lint && in_array(t1, t2) == NULL) {
+				t2 = force_string(t2);
+				lintwarn(_("reference to uninitialized element `%s[\"%.*s\"]'"),
+					array_vname(t1), (int) t2->stlen, t2->stptr);
+				if (t2->stlen == 0)
+					lintwarn(_("subscript of array `%s' is null string"), array_vname(t1));
+			}
+			lhs = assoc_lookup(t1, t2);
+			if ((*lhs)->type == Node_var_array) {
+				t2 = force_string(t2);
+				fatal(_("attempt to use array `%s[\"%.*s\"]' in a scalar context"),
+						array_vname(t1), (int) t2->stlen, t2->stptr);
+			}
+			DEREF(t2);
+store_plus:
+			t1 = *lhs;
+			x = force_number(t1)->numbr;
+			if (pc->initval != NULL)	/* constant increment */
+				x2 = pc->initval->numbr;
+			else {
+				t2 = POP_SCALAR();
+				x2 = force_number(t2)->numbr;
+				DEREF(t2);
+			}
+			if (t1->valref == 1 && t1->flags == (MALLOC|NUMCUR|NUMBER)) {
+				/* optimization */
+				t1->numbr = x + x2;
+			} else {
+				*lhs = make_number(x + x2);
+				unref(t1);
+			}
+			break;
+
+		OPCASE(Op_assign_concat):
 			/* x = x ... string concatenation optimization */
 			lhs = get_lhs(pc->memory, false);
 			t1 = force_string(*lhs);
@@ -629,28 +831,40 @@ mod:
 				*lhs = dupnode(t1);
 			}
 
+			/*
+			 * The buffer grows geometrically and remembers its size
+			 * (STRCAP), so that building a long string by appending
+			 * to it costs amortized constant time per append.
+			 */
 			if (t1 != t2 && t1->valref == 1 && (t1->flags & MPFN) == 0) {
 				size_t nlen = t1->stlen + t2->stlen;
 
-				erealloc(t1->stptr, char *, nlen + 2, "r_interpret");
+				if ((t1->flags & STRCAP) == 0 || nlen + 2 > t1->stcap) {
+					t1->stcap = concat_capacity(nlen + 2);
+					erealloc(t1->stptr, char *, t1->stcap, "r_interpret");
+				}
 				memcpy(t1->stptr + t1->stlen, t2->stptr, t2->stlen);
 				t1->stlen = nlen;
 				t1->stptr[nlen] = '\0';
 				t1->flags &= ~(NUMCUR|NUMBER|NUMINT);
+				t1->flags |= STRCAP;
 			} else {
 				size_t nlen = t1->stlen + t2->stlen;  
+				size_t cap = concat_capacity(nlen + 2);
 				char *p;
 
-				emalloc(p, char *, nlen + 2, "r_interpret");
+				emalloc(p, char *, cap, "r_interpret");
 				memcpy(p, t1->stptr, t1->stlen);
 				memcpy(p + t1->stlen, t2->stptr, t2->stlen);
 				unref(*lhs);
 				t1 = *lhs = make_str_node(p, nlen, ALREADY_MALLOCED); 
+				t1->stcap = cap;
+				t1->flags |= STRCAP;
 			}
 			DEREF(t2);
 			break;
 
-		case Op_assign:
+		OPCASE(Op_assign):
 			lhs = POP_ADDRESS();
 			r = TOP_SCALAR();
 			unref(*lhs);
@@ -660,21 +874,21 @@ mod:
 			break;
 
 		/* numeric assignments */
-		case Op_assign_plus:
-		case Op_assign_minus:
-		case Op_assign_times:
-		case Op_assign_quotient:
-		case Op_assign_mod:
-		case Op_assign_exp:
+		OPCASE(Op_assign_plus):
+		OPCASE(Op_assign_minus):
+		OPCASE(Op_assign_times):
+		OPCASE(Op_assign_quotient):
+		OPCASE(Op_assign_mod):
+		OPCASE(Op_assign_exp):
 			op_assign(op);
 			break;
 
-		case Op_var_update:        /* update value of NR, FNR or NF */
+		OPCASE(Op_var_update):        /* update value of NR, FNR or NF */
 			pc->update_var();
 			break;
 
-		case Op_var_assign:
-		case Op_field_assign:
+		OPCASE(Op_var_assign):
+		OPCASE(Op_field_assign):
 			r = TOP();
 			if (pc->assign_ctxt == Op_sub_builtin
 				&& get_number_si(r) == 0	/* top of stack has a number == 0 */
@@ -700,12 +914,12 @@ mod:
 				pc->field_assign();
 			break;
 
-		case Op_concat:
+		OPCASE(Op_concat):
 			r = concat_exp(pc->expr_count, pc->concat_flag & CSUBSEP);
 			PUSH(r);
 			break;
 
-		case Op_K_case:
+		OPCASE(Op_K_case):
 			if ((pc + 1)->match_exp) {
 				/* match a constant regex against switch expression instead of $0. */
 
@@ -730,19 +944,19 @@ mod:
 			}
 			break;
 
-		case Op_K_delete:
+		OPCASE(Op_K_delete):
 			t1 = POP_ARRAY();
 			do_delete(t1, pc->expr_count);
 			stack_adj(-pc->expr_count);
 			break;
 
-		case Op_K_delete_loop:
+		OPCASE(Op_K_delete_loop):
 			t1 = POP_ARRAY();
 			lhs = POP_ADDRESS();	/* item */
 			do_delete_loop(t1, lhs);
 			break;
 
-		case Op_in_array:
+		OPCASE(Op_in_array):
 			t1 = POP_ARRAY();
 			t2 = mk_sub(pc->expr_count);
 			r = node_Boolean[(in_array(t1, t2) != NULL)];
@@ -751,7 +965,7 @@ mod:
 			PUSH(r);
 			break;
 
-		case Op_arrayfor_init:
+		OPCASE(Op_arrayfor_init):
 		{
 			NODE **list = NULL;
 			NODE *array, *sort_str;
@@ -801,7 +1015,7 @@ arrayfor:
 		}
 			break;
 
-		case Op_arrayfor_incr:
+		OPCASE(Op_arrayfor_incr):
 			r = TOP();	/* Node_arrayfor */
 			if (++r->cur_idx == r->for_list_size) {
 				NODE *array;
@@ -818,18 +1032,18 @@ arrayfor:
 			*lhs = dupnode(t1);
 			break;
 
-		case Op_arrayfor_final:
+		OPCASE(Op_arrayfor_final):
 			r = POP();
 			assert(r->type == Node_arrayfor);
 			free_arrayfor(r);
 			break;
 
-		case Op_builtin:
+		OPCASE(Op_builtin):
 			r = pc->builtin(pc->expr_count);
 			PUSH(r);
 			break;
 
-		case Op_ext_builtin:
+		OPCASE(Op_ext_builtin):
 		{
 			int arg_count = pc->expr_count;
 			awk_value_t result;
@@ -846,24 +1060,24 @@ arrayfor:
 		}
 			break;
 
-		case Op_sub_builtin:	/* sub, gsub and gensub */
+		OPCASE(Op_sub_builtin):	/* sub, gsub and gensub */
 			r = do_sub(pc->expr_count, pc->sub_flags);
 			PUSH(r);
 			break;
 
-		case Op_K_print:
+		OPCASE(Op_K_print):
 			do_print(pc->expr_count, pc->redir_type);
 			break;
 
-		case Op_K_printf:
+		OPCASE(Op_K_printf):
 			do_printf(pc->expr_count, pc->redir_type);
 			break;
 
-		case Op_K_print_rec:
+		OPCASE(Op_K_print_rec):
 			do_print_rec(pc->expr_count, pc->redir_type);
 			break;
 
-		case Op_push_re:
+		OPCASE(Op_push_re):
 			m = pc->memory;
 			if (m->type == Node_dynregex) {
 				r = POP_STRING();
@@ -873,7 +1087,7 @@ arrayfor:
 			PUSH(m);
 			break;
 			
-		case Op_match_rec:
+		OPCASE(Op_match_rec):
 			m = pc->memory;
 			t1 = *get_field(0, (Func_ptr *) 0);
 match_re:
@@ -902,9 +1116,9 @@ match_re:
 			PUSH(r);
 			break;
 
-		case Op_nomatch:
+		OPCASE(Op_nomatch):
 			/* fall through */
-		case Op_match:
+		OPCASE(Op_match):
 			m = pc->memory;
 			t1 = TOP_STRING();
 			if (m->type == Node_dynregex) {
@@ -916,10 +1130,10 @@ match_re:
 			goto match_re;
 			break;
 
-		case Op_indirect_func_call:
+		OPCASE(Op_indirect_func_call):
 		{
-			NODE *f = NULL;
-			int arg_count;
+			NODE *f;
+			int arg_count, i;
 
 			arg_count = (pc + 1)->expr_count;
 			t1 = PEEK(arg_count);	/* indirect var */
@@ -927,33 +1141,25 @@ match_re:
 			if (t1->type != Node_val)	/* @a[1](p) not allowed in grammar */
 				fatal(_("indirect function call requires a simple scalar value"));
 
-			t1 = force_string(t1);
-			if (t1->stlen > 0) {
-				/* retrieve function definition node */
-				f = pc->func_body;
-				if (f != NULL && strcmp(f->vname, t1->stptr) == 0) {
-					/* indirect var hasn't been reassigned */
-
-					ni = setup_frame(pc);
-					JUMPTO(ni);	/* Op_func */
-				}
-				f = lookup(t1->stptr);
-			}
+			/* retrieve function definition node */
+			i = indirect_lookup(pc, t1);
+			f = (pc + 1)->call_cache->func[i];
 
-			if (f == NULL || f->type != Node_func) {
-				if (f->type == Node_ext_func)
-					fatal(_("cannot (yet) call extension functions indirectly"));
-				else
-					fatal(_("function called indirectly through `%s' does not exist"),
-							pc->func_name);	
+			if (f->type == Node_ext_func) {
+				/* drop the indirect var from under the arguments */
+				memmove(stack_ptr - arg_count, stack_ptr - arg_count + 1,
+						arg_count * sizeof(STACK_ITEM));
+				decr_sp();
+				DEREF(t1);
+				JUMPTO((pc + 1)->call_cache->ext[i]);	/* Op_ext_builtin */
 			}
-			pc->func_body = f;     /* save for next call */
 
+			pc->func_body = f;
 			ni = setup_frame(pc);
 			JUMPTO(ni);	/* Op_func */
 		}
 
-		case Op_func_call:
+		OPCASE(Op_func_call):
 		{
 			NODE *f;
 
@@ -986,7 +1192,7 @@ match_re:
 			JUMPTO(ni);	/* Op_func */
 		}
 
-		case Op_K_return:
+		OPCASE(Op_K_return):
 			m = POP_SCALAR();       /* return value */
 
 			ni = pop_fcall();
@@ -996,7 +1202,44 @@ match_re:
 
 			JUMPTO(ni);
 
-		case Op_K_getline_redir:
+		OPCASE(Op_inline_enter):
+		{
+			/*
+			 * Bind the arguments of an inlined call (see awkgram.y,
+			 * inline_calls) to the callee's hidden variables.  Only
+			 * values are handled here; an untyped variable or an
+			 * array has to go through setup_frame() like any other
+			 * call.
+			 */
+			NODE *vars = pc->inline_vars;
+			long arg_count = pc->expr_count;
+			long i;
+
+			for (i = 0; i < arg_count; i++) {
+				if (PEEK(i)->type != Node_val)
+					JUMPTO((pc + 1)->target_call);
+			}
+			for (i = arg_count - 1; i >= 0; i--) {
+				unref(vars[i].var_value);
+				vars[i].var_value = POP();
+			}
+		}
+			break;
+
+		OPCASE(Op_inline_leave):
+		{
+			/* the return value stays on the stack */
+			NODE *vars = pc->inline_vars;
+			long i;
+
+			for (i = 0; i < pc->expr_count; i++) {
+				unref(vars[i].var_value);
+				vars[i].var_value = dupnode(Nnull_string);
+			}
+		}
+			break;
+
+		OPCASE(Op_K_getline_redir):
 			if ((currule == BEGINFILE || currule == ENDFILE)
 					&& pc->into_var == false
 					&& pc->redir_type == redirect_input)
@@ -1005,7 +1248,7 @@ match_re:
 			PUSH(r);
 			break;
 
-		case Op_K_getline:	/* no redirection */
+		OPCASE(Op_K_getline):	/* no redirection */
 			if (! currule || currule == BEGINFILE || currule == ENDFILE)
 				fatal(_("non-redirected `getline' invalid inside `%s' rule"),
 						ruletab[currule]);
@@ -1033,14 +1276,14 @@ match_re:
 			PUSH(r);
 			break;
 
-		case Op_after_endfile:
+		OPCASE(Op_after_endfile):
 			/* Find the execution state to return to */
 			ni = pop_exec_state(& currule, & source, NULL);
 
 			assert(ni->opcode == Op_newfile || ni->opcode == Op_K_getline);
 			JUMPTO(ni);
 
-		case Op_after_beginfile:
+		OPCASE(Op_after_beginfile):
 			after_beginfile(& curfile);
 
 			/* Find the execution state to return to */
@@ -1054,7 +1297,7 @@ match_re:
 
 			break;	/* read a record, Op_get_record */
 
-		case Op_newfile:
+		OPCASE(Op_newfile):
 		{
 			int ret;
 
@@ -1078,7 +1321,7 @@ match_re:
 		}
 			break;
 			
-		case Op_get_record:		
+		OPCASE(Op_get_record):		
 		{
 			int errcode = 0;
 
@@ -1105,7 +1348,7 @@ match_re:
 		}
 			break;
 
-		case Op_K_nextfile:
+		OPCASE(Op_K_nextfile):
 		{
 			int ret;
 
@@ -1152,7 +1395,7 @@ match_re:
 		}
 			break;
 
-		case Op_K_exit:
+		OPCASE(Op_K_exit):
 			/* exit not allowed in user-defined comparison functions for "sorted_in";
 			 * This is done so that END blocks aren't executed more than once.
 			 */
@@ -1195,26 +1438,26 @@ match_re:
 				ni = pc->target_end;
 			JUMPTO(ni);
 
-		case Op_K_next:
+		OPCASE(Op_K_next):
 			if (currule != Rule)
 				fatal(_("`next' cannot be called from a `%s' rule"), ruletab[currule]);
 
 			pop_stack();
 			JUMPTO(pc->target_jmp);	/* Op_get_record, read next record */
 
-		case Op_pop:
+		OPCASE(Op_pop):
 			r = POP_SCALAR();
 			DEREF(r);
 			break;
 
-		case Op_line_range:
+		OPCASE(Op_line_range):
 			if (pc->triggered)		/* evaluate right expression */
 				JUMPTO(pc->target_jmp);
 			/* else
 				evaluate left expression */
 			break;
 
-		case Op_cond_pair:
+		OPCASE(Op_cond_pair):
 		{
 			int result;
 			INSTRUCTION *ip;
@@ -1240,24 +1483,24 @@ match_re:
 			JUMPTO(pc->target_jmp);
 		}
 
-		case Op_exec_count:
+		OPCASE(Op_exec_count):
 			if (do_profile)
 				pc->exec_count++;
 			break;
 
-		case Op_no_op:
-		case Op_K_do:
-		case Op_K_while:
-		case Op_K_for:
-		case Op_K_arrayfor:
-		case Op_K_switch:
-		case Op_K_default:
-		case Op_K_if:
-		case Op_K_else:
-		case Op_cond_exp:
+		OPCASE(Op_no_op):
+		OPCASE(Op_K_do):
+		OPCASE(Op_K_while):
+		OPCASE(Op_K_for):
+		OPCASE(Op_K_arrayfor):
+		OPCASE(Op_K_switch):
+		OPCASE(Op_K_default):
+		OPCASE(Op_K_if):
+		OPCASE(Op_K_else):
+		OPCASE(Op_cond_exp):
 			break;
 
-		default:
+		OPDEFAULT:
 			fatal(_("Sorry, don't know how to interpret `%s'"), opcode2str(op));
 		}
 
@@ -1270,4 +1513,6 @@ match_re:
 
 #undef mk_sub
 #undef JUMPTO
+#undef OPCASE
+#undef OPDEFAULT
 }
@@ -38,6 +38,25 @@
 #include <sys/ioctl.h>
 #endif /* HAVE_SYS_IOCTL_H */
 
+#if defined(HAVE_MMAP) && defined(HAVE_SYS_MMAN_H)
+#include <sys/mman.h>
+#if ! defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS	MAP_ANON
+#endif
+#if defined(MAP_ANONYMOUS) && defined(MAP_FIXED)
+#define USE_MMAP	1
+#endif
+#endif /* HAVE_MMAP && HAVE_SYS_MMAN_H */
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#define USE_READ_AHEAD	1
+#endif
+
+#ifdef HAVE_LANGINFO_CODESET
+#include <langinfo.h>
+#endif
+
 #ifndef O_ACCMODE
 #define O_ACCMODE	(O_RDONLY|O_WRONLY|O_RDWR)
 #endif
@@ -187,7 +206,8 @@ typedef enum scanstate {
         NOSTATE,        /* scanning not started yet (all) */
         INLEADER,       /* skipping leading data (RS = "") */
         INDATA,         /* in body of record (all) */
-        INTERM          /* scanning terminator (RS = "", RS = regexp) */
+        INTERM,         /* scanning terminator (RS = "", RS = regexp) */
+        INQUOTE         /* inside a quoted field (--csv) */
 } SCANSTATE;
 
 /*
@@ -225,10 +245,34 @@ static bool find_two_way_processor(const char *name, struct redirect *rp);
 static RECVALUE rs1scan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state);
 static RECVALUE rsnullscan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state);
 static RECVALUE rsrescan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state);
+static RECVALUE rsstrscan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state);
+static RECVALUE csvscan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state);
+static char *find_string(char *buf, size_t buflen, const char *str, size_t len);
+static bool rs_is_literal(const char *rs, size_t len);
+static bool rs_has_case(const char *rs, size_t len);
 
 static RECVALUE (*matchrec)(IOBUF *iop, struct recmatch *recm, SCANSTATE *state) = rs1scan;
 
 static int get_a_record(char **out, IOBUF *iop, int *errcode);
+#ifdef USE_MMAP
+static bool iop_can_mmap(IOBUF *iop);
+static ssize_t map_input_window(IOBUF *iop);
+static ssize_t unmap_input(IOBUF *iop);
+static void drop_input_map(IOBUF *iop, off_t resume);
+static void copy_mapped_record(IOBUF *iop, struct recmatch *recm);
+#endif
+static bool want_read_ahead(IOBUF *iop);
+#ifdef USE_READ_AHEAD
+static void start_read_ahead(IOBUF *iop);
+static void stop_read_ahead(IOBUF *iop);
+static ssize_t read_ahead_get(struct read_ahead *ra, char *buf, size_t size);
+
+#define iop_read(iop, buf, len) \
+	((iop)->readahead != NULL ? read_ahead_get((iop)->readahead, buf, len) \
+		: (iop)->read_func((iop)->public.fd, buf, len))
+#else
+#define iop_read(iop, buf, len)	(iop)->read_func((iop)->public.fd, buf, len)
+#endif
 
 static void free_rp(struct redirect *rp);
 static int inetfile(const char *str, int *length, int *family);
@@ -241,6 +285,19 @@ static bool read_can_timeout = false;
 static long read_timeout;
 static long read_default_timeout;
 
+#ifdef USE_MMAP
+static bool use_mmap = true;
+static sigjmp_buf map_fault_tag;	/* where get_a_record() recovers */
+static volatile sig_atomic_t map_fault_armed = false;
+static off_t map_fault_resume;		/* file offset of the record being read */
+#endif
+
+static char *find_rs1(IOBUF *iop, char *bp, int rs);
+static void init_byte_mask(void);
+
+uint64_t (*byte_mask)(const char *p, int c) = NULL;
+uint64_t (*byte_mask3)(const char *p, int c1, int c2, int c3) = NULL;
+
 static struct redirect *red_head = NULL;
 static NODE *RS = NULL;
 static Regexp *RS_re_yes_case;	/* regexp for RS when ignoring case */
@@ -248,6 +305,7 @@ static Regexp *RS_re_no_case;	/* regexp for RS when not ignoring case */
 static Regexp *RS_regexp;
 
 bool RS_is_null;
+static bool RS_is_literal;	/* RS is a plain string, can use rsstrscan() */
 
 extern NODE *ARGC_node;
 extern NODE *ARGV_node;
@@ -279,6 +337,14 @@ init_io()
 	 */
 	if (PROCINFO_node != NULL)	
 		read_can_timeout = true;
+
+#ifdef USE_MMAP
+	if (getenv("GAWK_NO_MMAP") != NULL)
+		use_mmap = false;
+#endif
+
+	if (getenv("GAWK_NO_SIMD") == NULL)
+		init_byte_mask();
 }
 
 
@@ -577,6 +643,12 @@ iop_close(IOBUF *iop)
 	if (iop->public.close_func != NULL)
 		iop->public.close_func(&iop->public);
 
+#ifdef USE_READ_AHEAD
+	/* the helper thread may be sitting in read() on the fd */
+	if (iop->readahead != NULL)
+		stop_read_ahead(iop);
+#endif
+
 	if (iop->public.fd != INVALID_HANDLE) {
 		if (iop->public.fd == fileno(stdin)
 		    || iop->public.fd == fileno(stdout)
@@ -595,8 +667,14 @@ iop_close(IOBUF *iop)
 	 * can do this a bit better.
 	 */
 	if (iop->buf) {
+		size_t bufsize = iop->size;
+
+#ifdef USE_MMAP
+		if ((iop->flag & IOP_MMAPPED) != 0)
+			bufsize = iop->maplen;
+#endif
 		if ((fields_arr[0]->stptr >= iop->buf)
-		    && (fields_arr[0]->stptr < (iop->buf + iop->size))) {
+		    && (fields_arr[0]->stptr < (iop->buf + bufsize))) {
 			NODE *t;
 
 			t = make_string(fields_arr[0]->stptr,
@@ -613,9 +691,18 @@ iop_close(IOBUF *iop)
 			 * corrupted and that references to $0 and fields work.
 			 */
 		}
+#ifdef USE_MMAP
+		if ((iop->flag & IOP_MMAPPED) != 0)
+			(void) munmap(iop->buf, iop->maplen);
+		else
+#endif
 		efree(iop->buf);
 		iop->buf = NULL;
 	}
+#ifdef USE_MMAP
+	if (iop->recbuf != NULL)
+		efree(iop->recbuf);
+#endif
 	efree(iop);
 	return ret == -1 ? 1 : 0;
 }
@@ -2974,6 +3061,619 @@ grow_iop_buffer(IOBUF *iop)
 	iop->end = iop->buf + iop->size;
 }
 
+#ifdef USE_MMAP
+/*
+ * Regular files are mapped into memory instead of being read(), a window
+ * of MMAP_WINDOW bytes at a time.  The scanning routines work directly on
+ * the mapping; instead of shifting the partial record down to the front
+ * of the buffer and reading more data after it, get_a_record() just slides
+ * the window forward.  Each window is followed by one page of anonymous
+ * memory, so that the scanners can still store their sentinel at
+ * iop->dataend, even when the file size is a multiple of the page size.
+ * Touching a page that a truncation has cut off raises SIGBUS; see
+ * get_a_record() and input_map_fault() for how we recover from that.
+ * Only the scanners and copy_mapped_record() ever touch the mapping, and
+ * neither allocates memory, so a fault can be recovered from by jumping
+ * out of them.  For the same reason input is never mapped when RS is a
+ * regexp: research() can allocate.  Each record is still copied out of
+ * the mapping, into iop->recbuf, before set_record() copies it again as
+ * $0; pointing $0 into the mapping would leave it open to the same fault.
+ *
+ * Setting GAWK_NO_MMAP in the environment turns all of this off.
+ */
+
+#ifndef MMAP_WINDOW
+#define MMAP_WINDOW	(sizeof(char *) >= 8 ? 64 * 1024 * 1024 : 4 * 1024 * 1024)
+#endif
+
+static size_t map_pagesize = 0;
+
+/* iop_can_mmap --- return true if the input can be mapped instead of read */
+
+static bool
+iop_can_mmap(IOBUF *iop)
+{
+	off_t pos;
+
+	if (! use_mmap
+	    || iop->public.fd == INVALID_HANDLE
+	    || (iop->flag & IOP_IS_TTY) != 0
+	    || ! S_ISREG(iop->public.sbuf.st_mode)
+	    || iop->public.sbuf.st_size == 0
+	    || matchrec == rsrescan)
+		return false;
+
+	/* standard input need not be positioned at the start of the file */
+	if ((pos = lseek(iop->public.fd, (off_t) 0, SEEK_CUR)) == (off_t) -1)
+		return false;
+
+	if (map_pagesize == 0)
+		map_pagesize = getpagesize();
+
+	iop->mapoff = pos;
+	return true;
+}
+
+/*
+ * map_input_window --- map the next window of a regular file.  The data
+ * between iop->off and iop->dataend is kept.  Return the amount of new
+ * data that follows it, the same way read() would.
+ */
+
+static ssize_t
+map_input_window(IOBUF *iop)
+{
+	struct stat sbuf;
+	off_t dataoff;	/* file offset of iop->off */
+	off_t base;	/* file offset of the new window */
+	size_t valid;	/* amount of old data to keep */
+	size_t len;
+	char *p;
+
+	dataoff = iop->mapoff;
+	valid = 0;
+	if (iop->buf != NULL) {
+		dataoff += iop->off - iop->buf;
+		valid = iop->dataend - iop->off;
+	}
+
+	if (fstat(iop->public.fd, & sbuf) < 0)
+		return -1;
+	if (sbuf.st_size <= dataoff + (off_t) valid) {
+		if (sbuf.st_size == dataoff + (off_t) valid)
+			return 0;	/* EOF */
+		/* the file shrank while we were reading it */
+		return unmap_input(iop);
+	}
+
+	base = dataoff - (dataoff % map_pagesize);
+	len = (dataoff - base) + valid + MMAP_WINDOW;
+	if ((off_t) len > sbuf.st_size - base)
+		len = sbuf.st_size - base;
+
+	/* reserve room for the window and the sentinel page, then map over it */
+	p = mmap(NULL, len + map_pagesize, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS, -1, (off_t) 0);
+	if (p == MAP_FAILED)
+		return unmap_input(iop);
+	if (mmap(p, len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED,
+			iop->public.fd, base) == MAP_FAILED) {
+		(void) munmap(p, len + map_pagesize);
+		return unmap_input(iop);
+	}
+#ifdef MADV_SEQUENTIAL
+	(void) madvise(p, len, MADV_SEQUENTIAL);
+#endif
+	if ((iop->flag & IOP_READ_AHEAD) != 0) {
+		/* start paging in this window and the next one */
+#ifdef MADV_WILLNEED
+		(void) madvise(p, len, MADV_WILLNEED);
+#endif
+#if defined(HAVE_POSIX_FADVISE) && defined(POSIX_FADV_WILLNEED)
+		(void) posix_fadvise(iop->public.fd, base + len,
+				MMAP_WINDOW, POSIX_FADV_WILLNEED);
+#endif
+	}
+
+	if (iop->buf != NULL)
+		(void) munmap(iop->buf, iop->maplen);
+	iop->buf = p;
+	iop->mapoff = base;
+	iop->maplen = len + map_pagesize;
+	iop->off = p + (dataoff - base);
+	iop->dataend = iop->off + valid;
+	iop->end = p + len;
+
+	/* leave the file offset where read() would have left it */
+	(void) lseek(iop->public.fd, base + len, SEEK_SET);
+
+	return iop->end - iop->dataend;
+}
+
+/*
+ * unmap_input --- go back to reading a mapped file with read().  Used
+ * when mapping fails, or when the file shrinks below what we have mapped.
+ * The data not yet consumed is read back into a regular buffer instead of
+ * being copied, since the mapping may already be past the end of the file;
+ * whatever the file has lost reads as NULs.
+ */
+
+static ssize_t
+unmap_input(IOBUF *iop)
+{
+	off_t dataoff;
+	size_t valid, got;
+	ssize_t n;
+	char *p;
+
+	dataoff = iop->mapoff;
+	valid = 0;
+	if (iop->buf != NULL) {
+		dataoff += iop->off - iop->buf;
+		valid = iop->dataend - iop->off;
+		(void) munmap(iop->buf, iop->maplen);
+	}
+
+	iop->flag &= ~IOP_MMAPPED;
+	iop->size = valid + iop->readsize + 2;
+	emalloc(p, char *, iop->size, "unmap_input");
+	iop->buf = iop->off = p;
+	iop->dataend = p + valid;
+	iop->end = p + iop->size;
+
+	if (lseek(iop->public.fd, dataoff, SEEK_SET) == (off_t) -1)
+		return -1;
+	for (got = 0; got < valid; got += n) {
+		n = iop->read_func(iop->public.fd, p + got, valid - got);
+		if (n == -1)
+			return -1;
+		if (n == 0)
+			break;
+	}
+	if (got < valid)
+		memset(p + got, '\0', valid - got);
+
+	return iop->read_func(iop->public.fd, iop->dataend, iop->readsize);
+}
+
+/*
+ * drop_input_map --- unmap the input and leave it empty, so that the next
+ * read() starts at offset resume.  Used after a fault, when nothing in the
+ * old mapping can be trusted, and when RS becomes a regexp.
+ */
+
+static void
+drop_input_map(IOBUF *iop, off_t resume)
+{
+	sigset_t mask;
+
+	/* after a fault the signal is still blocked: we jumped out of its handler */
+	sigemptyset(& mask);
+	sigaddset(& mask, SIGBUS);
+	(void) sigprocmask(SIG_UNBLOCK, & mask, NULL);
+
+	if ((iop->flag & IOP_MMAPPED) == 0)
+		fatal(_("internal error: SIGBUS while reading `%s'"), iop->public.name);
+
+	if (iop->buf != NULL)
+		(void) munmap(iop->buf, iop->maplen);
+	iop->flag &= ~(IOP_MMAPPED|IOP_AT_EOF);
+	iop->rsblock = NULL;
+	iop->size = iop->readsize + 2;
+	emalloc(iop->buf, char *, iop->size, "drop_input_map");
+	iop->off = iop->dataend = iop->buf;
+	iop->end = iop->buf + iop->size;
+	(void) lseek(iop->public.fd, resume, SEEK_SET);
+}
+
+/*
+ * copy_mapped_record --- copy a record and its terminator out of the
+ * mapping into iop->recbuf, and point recm at the copy.  The buffer is
+ * grown before the copy, so that a fault cannot land in the allocator.
+ */
+
+static void
+copy_mapped_record(IOBUF *iop, struct recmatch *recm)
+{
+	size_t len = recm->len + recm->rt_len;
+
+	assert(recm->rt_len == 0 || recm->rt_start == recm->start + recm->len);
+	if (len > iop->recsize) {
+		iop->recsize = len;
+		erealloc(iop->recbuf, char *, iop->recsize, "copy_mapped_record");
+	}
+
+	map_fault_armed = true;
+	memcpy(iop->recbuf, recm->start, len);
+	map_fault_armed = false;
+
+	recm->start = iop->recbuf;
+	if (recm->rt_start != NULL)
+		recm->rt_start = iop->recbuf + recm->len;
+}
+#endif /* USE_MMAP */
+
+/*
+ * input_map_fault --- called for SIGBUS.  Touching a page of a mapped
+ * file past its end raises SIGBUS, which happens when the file is
+ * truncated while we read it.  If that can be the cause, go back to
+ * get_a_record(), which switches the input to read().  Otherwise return,
+ * and the signal is fatal as usual.
+ */
+
+void
+input_map_fault(void)
+{
+#ifdef USE_MMAP
+	if (map_fault_armed) {
+		map_fault_armed = false;
+		siglongjmp(map_fault_tag, 1);
+	}
+#endif
+}
+
+/*
+ * Reading ahead.  If PROCINFO[input, "READ_AHEAD"] or PROCINFO["READ_AHEAD"]
+ * is nonzero when an input is first read, get_a_record() hands the read()
+ * calls for it to a helper thread.  The thread fills one buffer while the
+ * records in the other one are being processed, so that the time spent
+ * waiting for a slow producer (a pipe, a socket, a file on a network
+ * filesystem) overlaps with the time spent running the program.  Mapped
+ * files don't need a thread; the kernel is asked to page in the next window
+ * instead.  The thread calls nothing but read(), and it is not started
+ * for inputs that have a read timeout.
+ */
+
+/* want_read_ahead --- return true if PROCINFO asks for reading ahead */
+
+static bool
+want_read_ahead(IOBUF *iop)
+{
+	NODE *val, *sub;
+
+	if (PROCINFO_node == NULL)
+		return false;
+
+	val = in_PROCINFO(iop->public.name, "READ_AHEAD", NULL);
+	if (val == NULL) {
+		sub = make_string("READ_AHEAD", 10);
+		val = in_array(PROCINFO_node, sub);
+		unref(sub);
+	}
+	if (val == NULL)
+		return false;
+	(void) force_number(val);
+	return ! iszero(val);
+}
+
+#ifdef USE_READ_AHEAD
+
+#ifndef READ_AHEAD_SIZE
+#define READ_AHEAD_SIZE	(128 * 1024)
+#endif
+
+struct read_ahead {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;	/* signalled when a buffer changes hands */
+	int fd;
+	size_t bufsize;
+	struct {
+		char *data;
+		ssize_t count;	/* as returned by read() */
+		int errcode;	/* errno, if count is -1 */
+		bool full;	/* owned by the reader of the data */
+	} bufs[2];
+	int fill;		/* buffer the helper thread is filling */
+	int cur;		/* buffer gawk is consuming */
+	size_t used;		/* how much of it has been consumed */
+};
+
+/* read_ahead_unlock --- cancellation cleanup for read_ahead_thread */
+
+static void
+read_ahead_unlock(void *arg)
+{
+	struct read_ahead *ra = (struct read_ahead *) arg;
+
+	pthread_mutex_unlock(& ra->lock);
+}
+
+/* read_ahead_thread --- fill the two buffers in turn, until EOF or error */
+
+static void *
+read_ahead_thread(void *arg)
+{
+	struct read_ahead *ra = (struct read_ahead *) arg;
+	ssize_t n;
+
+	for (;;) {
+		pthread_mutex_lock(& ra->lock);
+		pthread_cleanup_push(read_ahead_unlock, ra);
+		while (ra->bufs[ra->fill].full)
+			pthread_cond_wait(& ra->cond, & ra->lock);
+		pthread_cleanup_pop(1);
+
+		do {
+			n = read(ra->fd, ra->bufs[ra->fill].data, ra->bufsize);
+		} while (n == -1 && errno == EINTR);
+
+		pthread_mutex_lock(& ra->lock);
+		ra->bufs[ra->fill].count = n;
+		ra->bufs[ra->fill].errcode = (n == -1 ? errno : 0);
+		ra->bufs[ra->fill].full = true;
+		pthread_cond_signal(& ra->cond);
+		pthread_mutex_unlock(& ra->lock);
+
+		if (n <= 0)
+			break;
+		ra->fill = ! ra->fill;
+	}
+	return NULL;
+}
+
+/* start_read_ahead --- start a helper thread for iop; quietly do nothing if we can't */
+
+static void
+start_read_ahead(IOBUF *iop)
+{
+	struct read_ahead *ra;
+	sigset_t all, old;
+	int rc;
+
+	emalloc(ra, struct read_ahead *, sizeof(struct read_ahead), "start_read_ahead");
+	memset(ra, '\0', sizeof(struct read_ahead));
+	ra->fd = iop->public.fd;
+	ra->bufsize = iop->readsize > READ_AHEAD_SIZE ? iop->readsize : READ_AHEAD_SIZE;
+	emalloc(ra->bufs[0].data, char *, ra->bufsize, "start_read_ahead");
+	emalloc(ra->bufs[1].data, char *, ra->bufsize, "start_read_ahead");
+	pthread_mutex_init(& ra->lock, NULL);
+	pthread_cond_init(& ra->cond, NULL);
+
+	/* signals are for the main thread; the helper starts with all of them blocked */
+	sigfillset(& all);
+	pthread_sigmask(SIG_SETMASK, & all, & old);
+	rc = pthread_create(& ra->thread, NULL, read_ahead_thread, ra);
+	pthread_sigmask(SIG_SETMASK, & old, NULL);
+
+	if (rc != 0) {
+		pthread_cond_destroy(& ra->cond);
+		pthread_mutex_destroy(& ra->lock);
+		efree(ra->bufs[0].data);
+		efree(ra->bufs[1].data);
+		efree(ra);
+		return;
+	}
+	iop->readahead = ra;
+}
+
+/* stop_read_ahead --- get rid of the helper thread, before the fd is closed */
+
+static void
+stop_read_ahead(IOBUF *iop)
+{
+	struct read_ahead *ra = iop->readahead;
+
+	pthread_cancel(ra->thread);
+	pthread_join(ra->thread, NULL);
+	pthread_cond_destroy(& ra->cond);
+	pthread_mutex_destroy(& ra->lock);
+	efree(ra->bufs[0].data);
+	efree(ra->bufs[1].data);
+	efree(ra);
+	iop->readahead = NULL;
+}
+
+/*
+ * read_ahead_get --- read() replacement: wait for the helper thread to
+ * fill a buffer, then copy out as much of the data as fits.  EOF and
+ * errors are sticky, as the thread is gone after them.
+ */
+
+static ssize_t
+read_ahead_get(struct read_ahead *ra, char *buf, size_t size)
+{
+	ssize_t total = 0;
+	size_t n;
+
+	while (size > 0) {
+		int i = ra->cur;
+
+		pthread_mutex_lock(& ra->lock);
+		if (! ra->bufs[i].full) {
+			if (total > 0) {
+				/* don't wait if we already have something */
+				pthread_mutex_unlock(& ra->lock);
+				break;
+			}
+			while (! ra->bufs[i].full)
+				pthread_cond_wait(& ra->cond, & ra->lock);
+		}
+		pthread_mutex_unlock(& ra->lock);
+
+		if (ra->bufs[i].count <= 0) {
+			if (total > 0)
+				break;
+			errno = ra->bufs[i].errcode;
+			return ra->bufs[i].count;
+		}
+
+		n = ra->bufs[i].count - ra->used;
+		if (n > size)
+			n = size;
+		memcpy(buf, ra->bufs[i].data + ra->used, n);
+		buf += n;
+		size -= n;
+		total += n;
+		ra->used += n;
+
+		if (ra->used == ra->bufs[i].count) {
+			/* hand the buffer back */
+			ra->used = 0;
+			ra->cur = ! i;
+			pthread_mutex_lock(& ra->lock);
+			ra->bufs[i].full = false;
+			pthread_cond_signal(& ra->cond);
+			pthread_mutex_unlock(& ra->lock);
+		}
+	}
+	return total;
+}
+#endif /* USE_READ_AHEAD */
+
+/*
+ * byte_mask(p, c) returns a mask with bit i set if p[i] == c, for the 64
+ * bytes starting at p.  It lets the scanners find every terminator or
+ * separator in a block with a handful of vector instructions, instead of
+ * looking at one byte at a time.  The version used is picked at startup
+ * based on what the CPU supports; if there is nothing better than plain
+ * C, byte_mask stays NULL and the callers use their byte-at-a-time loops.
+ * byte_mask3() is the same, but looks for any of three bytes.
+ */
+
+#if defined(__GNUC__) && (__GNUC__ >= 5 || defined(__clang__)) \
+	&& (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_X86_SIMD	1
+
+/* sse2_byte_mask --- byte_mask() using SSE2, 16 bytes at a time */
+
+__attribute__((target("sse2")))
+static uint64_t
+sse2_byte_mask(const char *p, int c)
+{
+	__m128i cv = _mm_set1_epi8((char) c);
+	uint64_t m0, m1, m2, m3;
+
+	m0 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((const __m128i *) p), cv));
+	m1 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((const __m128i *) (p + 16)), cv));
+	m2 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((const __m128i *) (p + 32)), cv));
+	m3 = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(
+			_mm_loadu_si128((const __m128i *) (p + 48)), cv));
+
+	return m0 | (m1 << 16) | (m2 << 32) | (m3 << 48);
+}
+
+/* avx2_byte_mask --- byte_mask() using AVX2, 32 bytes at a time */
+
+__attribute__((target("avx2")))
+static uint64_t
+avx2_byte_mask(const char *p, int c)
+{
+	__m256i cv = _mm256_set1_epi8((char) c);
+	uint64_t lo, hi;
+
+	lo = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			_mm256_loadu_si256((const __m256i *) p), cv));
+	hi = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			_mm256_loadu_si256((const __m256i *) (p + 32)), cv));
+
+	return lo | (hi << 32);
+}
+
+/* sse2_byte_mask3 --- byte_mask3() using SSE2 */
+
+__attribute__((target("sse2")))
+static uint64_t
+sse2_byte_mask3(const char *p, int c1, int c2, int c3)
+{
+	__m128i cv1 = _mm_set1_epi8((char) c1);
+	__m128i cv2 = _mm_set1_epi8((char) c2);
+	__m128i cv3 = _mm_set1_epi8((char) c3);
+	__m128i v;
+	uint64_t mask = 0;
+	int i;
+
+	for (i = 0; i < 64; i += 16) {
+		v = _mm_loadu_si128((const __m128i *) (p + i));
+		v = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, cv1),
+				_mm_cmpeq_epi8(v, cv2)), _mm_cmpeq_epi8(v, cv3));
+		mask |= (uint64_t) (uint32_t) _mm_movemask_epi8(v) << i;
+	}
+	return mask;
+}
+
+/* avx2_byte_mask3 --- byte_mask3() using AVX2 */
+
+__attribute__((target("avx2")))
+static uint64_t
+avx2_byte_mask3(const char *p, int c1, int c2, int c3)
+{
+	__m256i cv1 = _mm256_set1_epi8((char) c1);
+	__m256i cv2 = _mm256_set1_epi8((char) c2);
+	__m256i cv3 = _mm256_set1_epi8((char) c3);
+	__m256i v;
+	uint64_t lo, hi;
+
+	v = _mm256_loadu_si256((const __m256i *) p);
+	v = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, cv1),
+			_mm256_cmpeq_epi8(v, cv2)), _mm256_cmpeq_epi8(v, cv3));
+	lo = (uint32_t) _mm256_movemask_epi8(v);
+	v = _mm256_loadu_si256((const __m256i *) (p + 32));
+	v = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, cv1),
+			_mm256_cmpeq_epi8(v, cv2)), _mm256_cmpeq_epi8(v, cv3));
+	hi = (uint32_t) _mm256_movemask_epi8(v);
+
+	return lo | (hi << 32);
+}
+#endif /* x86 */
+
+/* init_byte_mask --- pick the best byte_mask() and byte_mask3() for this CPU */
+
+static void
+init_byte_mask(void)
+{
+#ifdef HAVE_X86_SIMD
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		byte_mask = avx2_byte_mask;
+		byte_mask3 = avx2_byte_mask3;
+	} else if (__builtin_cpu_supports("sse2")) {
+		byte_mask = sse2_byte_mask;
+		byte_mask3 = sse2_byte_mask3;
+	}
+#endif
+}
+
+/*
+ * find_rs1 --- return a pointer to the first rs at or after bp; the caller
+ * has stored rs at iop->dataend as a sentinel.  The mask for the block
+ * where the terminator was found is kept in the IOBUF, so that the next
+ * few records in the same block don't need to look at the data again.
+ * get_a_record() clears iop->rsblock whenever the buffer contents move.
+ */
+
+static char *
+find_rs1(IOBUF *iop, char *bp, int rs)
+{
+	uint64_t mask;
+
+	if (iop->rsblock != NULL && iop->rschar == rs
+	    && bp >= iop->rsblock && bp < iop->rsblock + 64) {
+		mask = iop->rsmask & (~ (uint64_t) 0 << (bp - iop->rsblock));
+		if (mask != 0)
+			return iop->rsblock + lowest_bit(mask);
+		bp = iop->rsblock + 64;
+	}
+
+	for (; bp + 64 <= iop->dataend; bp += 64) {
+		if ((mask = byte_mask(bp, rs)) != 0) {
+			iop->rsblock = bp;
+			iop->rsmask = mask;
+			iop->rschar = rs;
+			return bp + lowest_bit(mask);
+		}
+	}
+
+	/* less than a block left, finish up the slow way */
+	while (*bp != rs)
+		bp++;
+	return bp;
+}
+
 /* Here are the routines. */
 
 /* rs1scan --- scan for a single character record terminator */
@@ -3095,8 +3795,11 @@ rs1scan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state)
 		}
 	}
 #endif
-	while (*bp != rs)
-		bp++;
+	if (byte_mask != NULL)
+		bp = find_rs1(iop, bp, rs);
+	else
+		while (*bp != rs)
+			bp++;
 
 	/* set len to what we have so far, in case this is all there is */
 	recm->len = bp - recm->start;
@@ -3220,6 +3923,144 @@ again:
 	return REC_OK;
 }
 
+/*
+ * rsstrscan --- search for a multicharacter RS that has no regexp
+ * metacharacters in it.  This finds the same terminators as rsrescan()
+ * would, without going through the regexp matcher.
+ */
+
+static RECVALUE
+rsstrscan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state)
+{
+	char *bp, *rt;
+	size_t rslen = RS->stlen;
+
+	memset(recm, '\0', sizeof(struct recmatch));
+	recm->start = iop->off;
+
+	bp = iop->off;
+	if (*state == INDATA)
+		bp += iop->scanoff;
+
+	rt = find_string(bp, iop->dataend - bp, RS->stptr, rslen);
+	if (rt == NULL) {
+		/* set len, in case this all there is. */
+		recm->len = iop->dataend - iop->off;
+		/*
+		 * The terminator may straddle the end of the buffer; back
+		 * up enough to see all of it when there is more data.
+		 */
+		*state = INDATA;
+		iop->scanoff = recm->len >= rslen - 1 ? recm->len - (rslen - 1) : 0;
+		return NOTERM;
+	}
+
+	recm->len = rt - iop->off;
+	recm->rt_start = rt;
+	recm->rt_len = rslen;
+	*state = NOSTATE;
+	return REC_OK;
+}
+
+/* find_string --- find the first occurrence of str in buf, like memmem() */
+
+static char *
+find_string(char *buf, size_t buflen, const char *str, size_t len)
+{
+#ifdef HAVE_MEMMEM
+	return (char *) memmem(buf, buflen, str, len);
+#else
+	char *bp, *end;
+
+	if (buflen < len)
+		return NULL;
+	end = buf + buflen - len + 1;
+	for (bp = buf; bp < end; bp++) {
+		bp = (char *) memchr(bp, str[0], end - bp);
+		if (bp == NULL)
+			break;
+		if (memcmp(bp, str, len) == 0)
+			return bp;
+	}
+	return NULL;
+#endif
+}
+
+/* rs_is_literal --- return true if RS can be searched for as a plain string */
+
+static bool
+rs_is_literal(const char *rs, size_t len)
+{
+	static const char metachars[] = "\\^$.[]|()*+?{}";
+	bool ascii = true;
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		if (rs[i] == '\0' || strchr(metachars, rs[i]) != NULL)
+			return false;
+		if ((rs[i] & 0x80) != 0)
+			ascii = false;
+	}
+
+	/*
+	 * In a multibyte locale, the bytes of RS could show up in the
+	 * middle of some other character.  That can't happen with UTF-8.
+	 */
+	if (gawk_mb_cur_max > 1 && ! ascii) {
+#ifdef HAVE_LANGINFO_CODESET
+		return (strcmp(nl_langinfo(CODESET), "UTF-8") == 0);
+#else
+		return false;
+#endif
+	}
+	for (i = 0; i < len; i++)
+		if (! byte_is_char(rs[i]))
+			return false;
+
+	return true;
+}
+
+/*
+ * byte_is_char --- return true if byte c, wherever it shows up in the
+ * data, is a character by itself and not part of a multibyte character.
+ * This is what allows searching for it with memchr() and friends.
+ * See the comment in rs1scan() for the 0x30.
+ */
+
+bool
+byte_is_char(int c)
+{
+	static int utf8 = -1;
+
+	c &= 0xFF;
+	if (gawk_mb_cur_max == 1 || c < 0x30)
+		return true;
+	if (c >= 0x80)
+		return false;
+
+	if (utf8 == -1) {
+#ifdef HAVE_LANGINFO_CODESET
+		utf8 = (strcmp(nl_langinfo(CODESET), "UTF-8") == 0);
+#else
+		utf8 = 0;
+#endif
+	}
+	return (utf8 == 1);
+}
+
+/* rs_has_case --- return true if IGNORECASE could make a difference to RS */
+
+static bool
+rs_has_case(const char *rs, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++)
+		if (isalpha((unsigned char) rs[i]) || (rs[i] & 0x80) != 0)
+			return true;
+	return false;
+}
+
 /* rsnullscan --- handle RS = "" */
 
 static RECVALUE
@@ -3296,6 +4137,78 @@ find_longest_terminator:
 	return REC_OK;
 }
 
+/* find_csv_char --- return the first quote or newline at or after bp, or end */
+
+static char *
+find_csv_char(char *bp, char *end)
+{
+	uint64_t mask;
+
+	if (byte_mask3 != NULL)
+		for (; end - bp >= 64; bp += 64)
+			if ((mask = byte_mask3(bp, '"', '\n', '\n')) != 0)
+				return bp + lowest_bit(mask);
+
+	while (bp < end && *bp != '"' && *bp != '\n')
+		bp++;
+	return bp;
+}
+
+/*
+ * csvscan --- find the end of a CSV record, for --csv.  The record ends
+ * at a newline that isn't inside double quotes, and a carriage return
+ * just before it is part of the terminator.  A doubled quote inside a
+ * quoted field just closes and reopens the quotes, so only the quotes
+ * need counting.
+ */
+
+static RECVALUE
+csvscan(IOBUF *iop, struct recmatch *recm, SCANSTATE *state)
+{
+	char *bp;
+	char *end = iop->dataend;
+	bool inquote = (*state == INQUOTE);
+
+	memset(recm, '\0', sizeof(struct recmatch));
+	recm->start = iop->off;
+
+	bp = iop->off;
+	if (*state != NOSTATE)	/* skip over data we've already seen */
+		bp += iop->scanoff;
+
+	for (;;) {
+		if (inquote)
+			bp = memchr(bp, '"', end - bp);
+		else
+			bp = find_csv_char(bp, end);
+		if (bp == NULL || bp == end)
+			break;
+		if (*bp == '"') {
+			inquote = ! inquote;
+			bp++;
+			continue;
+		}
+
+		/* an unquoted newline */
+		recm->len = bp - recm->start;
+		recm->rt_start = bp;
+		recm->rt_len = 1;
+		if (bp > recm->start && bp[-1] == '\r') {
+			recm->len--;
+			recm->rt_start--;
+			recm->rt_len++;
+		}
+		*state = NOSTATE;
+		return REC_OK;
+	}
+
+	/* set len to what we have so far, in case this is all there is */
+	recm->len = end - recm->start;
+	*state = (inquote ? INQUOTE : INDATA);
+	iop->scanoff = end - iop->off;
+	return NOTERM;
+}
+
 /*
  * get_a_record --- read a record from IOP into out,
  * return length of EOF, set RT.
@@ -3338,7 +4251,29 @@ get_a_record(char **out,        /* pointer to pointer to data */
 
         /* fill initial buffer */
 	if (has_no_data(iop) || no_data_left(iop)) {
-		iop->count = iop->read_func(iop->public.fd, iop->buf, iop->readsize);
+		iop->rsblock = NULL;
+		if (has_no_data(iop) && want_read_ahead(iop))
+			iop->flag |= IOP_READ_AHEAD;
+#ifdef USE_MMAP
+		if (has_no_data(iop) && iop_can_mmap(iop)) {
+			efree(iop->buf);
+			iop->buf = NULL;
+			iop->flag |= IOP_MMAPPED;
+		}
+		if ((iop->flag & IOP_MMAPPED) != 0) {
+			iop->off = iop->dataend;	/* nothing to keep */
+			iop->count = map_input_window(iop);
+		} else
+#endif
+		{
+#ifdef USE_READ_AHEAD
+			if (has_no_data(iop)
+			    && (iop->flag & IOP_READ_AHEAD) != 0
+			    && iop->read_func == ( ssize_t(*)() ) read)
+				start_read_ahead(iop);
+#endif
+			iop->count = iop_read(iop, iop->buf, iop->readsize);
+		}
 		if (iop->count == 0) {
 			iop->flag |= IOP_AT_EOF;
 			return EOF;
@@ -3346,12 +4281,32 @@ get_a_record(char **out,        /* pointer to pointer to data */
 			iop->flag |= IOP_AT_EOF; 
 			*errcode = errno;
 			return EOF;
+#ifdef USE_MMAP
+		} else if ((iop->flag & IOP_MMAPPED) != 0) {
+			iop->dataend += iop->count;
+#endif
 		} else {
 			iop->dataend = iop->buf + iop->count;
 			iop->off = iop->buf;
 		}
 	}
 
+#ifdef USE_MMAP
+	if ((iop->flag & IOP_MMAPPED) != 0) {
+		map_fault_resume = iop->mapoff + (iop->off - iop->buf);
+		if (matchrec == rsrescan) {
+			/* RS is now a regexp; see the comment above iop_can_mmap() */
+			drop_input_map(iop, map_fault_resume);
+			return get_a_record(out, iop, errcode);
+		}
+		if (sigsetjmp(map_fault_tag, 0) != 0) {
+			/* the file shrank: go back to read() where this record starts */
+			drop_input_map(iop, map_fault_resume);
+			return get_a_record(out, iop, errcode);
+		}
+	}
+#endif
+
 	/* loop through file to find a record */
 	state = NOSTATE;
 	for (;;) {
@@ -3359,11 +4314,33 @@ get_a_record(char **out,        /* pointer to pointer to data */
 		size_t room_left;
 		size_t amt_to_read;
 
+#ifdef USE_MMAP
+		map_fault_armed = ((iop->flag & IOP_MMAPPED) != 0);
+#endif
 		ret = (*matchrec)(iop, & recm, & state);
+#ifdef USE_MMAP
+		map_fault_armed = false;
+#endif
 		iop->flag &= ~IOP_AT_START;
 		if (ret == REC_OK)
 			break;
 
+		/* the data is about to move; forget what rs1scan() found */
+		iop->rsblock = NULL;
+
+#ifdef USE_MMAP
+		if ((iop->flag & IOP_MMAPPED) != 0) {
+			/* slide the window forward, keeping the partial record */
+			iop->count = map_input_window(iop);
+
+			/* adjust recm contents */
+			recm.start = iop->off;
+			if (recm.rt_start != NULL)
+				recm.rt_start = iop->off + recm.len;
+			goto got_data;
+		}
+#endif
+
 		/* need to add more data to buffer */
 		/* shift data down in buffer */
 		dataend_off = iop->dataend - iop->off;
@@ -3404,7 +4381,10 @@ get_a_record(char **out,        /* pointer to pointer to data */
 		amt_to_read = min(amt_to_read, SSIZE_MAX);
 #endif
 
-		iop->count = iop->read_func(iop->public.fd, iop->dataend, amt_to_read);
+		iop->count = iop_read(iop, iop->dataend, amt_to_read);
+#ifdef USE_MMAP
+got_data:
+#endif
 		if (iop->count == -1) {
 			*errcode = errno;
 			iop->flag |= IOP_AT_EOF;
@@ -3422,6 +4402,11 @@ get_a_record(char **out,        /* pointer to pointer to data */
 
 	/* set record, RT, return right value */
 
+#ifdef USE_MMAP
+	if ((iop->flag & IOP_MMAPPED) != 0 && recm.len + recm.rt_len > 0)
+		copy_mapped_record(iop, & recm);
+#endif
+
 	/*
 	 * rtval is not a static pointer to avoid dangling pointer problems
 	 * in case awk code assigns to RT.  A remote possibility, to be sure,
@@ -3456,6 +4441,12 @@ get_a_record(char **out,        /* pointer to pointer to data */
 				set_RT(recm.rt_start, recm.rt_len);
 			/* else
 				leave it alone */
+		} else if (matchrec == rsstrscan || matchrec == csvscan) {
+			/* RT is usually the same string, as for rs1scan */
+			if ((rtval->flags & STRCUR) == 0
+			    || rtval->stlen != recm.rt_len
+			    || memcmp(rtval->stptr, recm.rt_start, recm.rt_len) != 0)
+				set_RT(recm.rt_start, recm.rt_len);
 		} else if (matchrec == rsnullscan) {
 			if (rtval->stlen >= recm.rt_len) {
 				rtval->stlen = recm.rt_len;
@@ -3503,11 +4494,15 @@ set_RS()
 		 * set_FS().
 		 */
 		RS_regexp = (IGNORECASE ? RS_re_no_case : RS_re_yes_case);
+		if (RS_is_literal)
+			matchrec = (IGNORECASE && rs_has_case(RS->stptr, RS->stlen))
+					? rsrescan : rsstrscan;
 		goto set_FS;
 	}
 	unref(save_rs);
 	save_rs = dupnode(RS_node->var_value);
 	RS_is_null = false;
+	RS_is_literal = false;
 	RS = force_string(RS_node->var_value);
 	/*
 	 * used to be if (RS_regexp != NULL) { refree(..); refree(..); ...; }.
@@ -3528,7 +4523,16 @@ set_RS()
 		RS_re_no_case = make_regexp(RS->stptr, RS->stlen, true, true, true);
 		RS_regexp = (IGNORECASE ? RS_re_no_case : RS_re_yes_case);
 
-		matchrec = rsrescan;
+		/*
+		 * Plain strings like "\r\n" are common enough to be worth
+		 * searching for directly.  The regexps are still needed if
+		 * IGNORECASE changes.
+		 */
+		RS_is_literal = rs_is_literal(RS->stptr, RS->stlen);
+		if (RS_is_literal && ! (IGNORECASE && rs_has_case(RS->stptr, RS->stlen)))
+			matchrec = rsstrscan;
+		else
+			matchrec = rsrescan;
 
 		if (do_lint && ! warned) {
 			lintwarn(_("multicharacter value of `RS' is a gawk extension"));
@@ -3537,6 +4541,8 @@ set_RS()
 	} else
 		matchrec = rs1scan;
 set_FS:
+	if (do_csv)	/* RS doesn't matter */
+		matchrec = csvscan;
 	if (current_field_sep() == Using_FS)
 		set_FS();
 }
@@ -3579,6 +4585,8 @@ iopflags2str(int flag)
 		{ IOP_AT_EOF,  "IOP_AT_EOF" },
 		{ IOP_CLOSED, "IOP_CLOSED" },
 		{ IOP_AT_START,  "IOP_AT_START" },
+		{ IOP_MMAPPED,  "IOP_MMAPPED" },
+		{ IOP_READ_AHEAD,  "IOP_READ_AHEAD" },
 		{ 0, NULL }
 	};
 
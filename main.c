@@ -135,7 +135,7 @@ static bool disallow_var_assigns = false;	/* true for --exec */
 static void add_preassign(enum assign_type type, char *val);
 
 int do_flags = false;
-bool do_optimize = true;		/* apply default optimizations */
+int do_optimize = 1;		/* apply default optimizations, more with -O */
 static int do_nostalgia = false;	/* provide a blast from the past */
 static int do_binary = false;		/* hands off my data! */
 static int do_version = false;		/* print version info */
@@ -186,6 +186,7 @@ static const struct option optab[] = {
 	{ "exec",		required_argument,	NULL,	'E' },
 	{ "use-lc-numeric",	no_argument,		& use_lc_numeric, 1 },
 	{ "characters-as-bytes", no_argument,		& do_binary,	 'b' },
+	{ "csv",		no_argument,		NULL,	'k' },
 	{ "sandbox",		no_argument,		NULL, 	'S' },
 	{ "bignum",		no_argument,		NULL,	'M' },
 #if defined(YYDEBUG) || defined(GAWKDEBUG)
@@ -203,7 +204,7 @@ main(int argc, char **argv)
 	/*
 	 * The + on the front tells GNU getopt not to rearrange argv.
 	 */
-	const char *optlist = "+F:f:v:W;m:bcCd::D::e:E:gh:i:l:L:nNo::Op::MPrStVY";
+	const char *optlist = "+F:f:v:W;m:bcCd::D::e:E:gh:i:kl:L:nNo::Op::MPrStVY";
 	bool stopped_early = false;
 	int old_optind;
 	int i;
@@ -408,6 +409,10 @@ main(int argc, char **argv)
 			(void) add_srcfile(SRC_INC, optarg, srcfiles, NULL, NULL);
 			break;
 
+		case 'k':
+			do_flags |= DO_CSV;
+			break;
+
 		case 'l':
 			(void) add_srcfile(SRC_EXTLIB, optarg, srcfiles, NULL, NULL);
 			break;
@@ -567,6 +572,11 @@ out:
 		warning(_("`--posix'/`--traditional' overrides `--non-decimal-data'"));
 	}
 
+	if (do_traditional && do_csv) {
+		do_flags &= ~DO_CSV;
+		warning(_("`--posix'/`--traditional' overrides `--csv'"));
+	}
+
 	if (do_lint && os_is_setuid())
 		warning(_("running %s setuid root may be a security problem"), myname);
 
@@ -738,6 +748,8 @@ out:
 	if (do_dump_vars)
 		dump_vars(varfile);
 
+	dump_op_pairs();
+
 	if (do_tidy_mem)
 		release_all_vars();
 	
@@ -803,6 +815,7 @@ usage(int exitval, FILE *fp)
 	fputs(_("\t-g\t\t\t--gen-pot\n"), fp);
 	fputs(_("\t-h\t\t\t--help\n"), fp);
 	fputs(_("\t-i includefile\t\t--include=includefile\n"), fp);
+	fputs(_("\t-k\t\t\t--csv\n"), fp);
 	fputs(_("\t-l library\t\t--load=library\n"), fp);
 	fputs(_("\t-L [fatal]\t\t--lint[=fatal]\n"), fp);
 	fputs(_("\t-n\t\t\t--non-decimal-data\n"), fp);
@@ -1167,6 +1180,9 @@ load_procinfo()
 	value = getegid();
 	update_PROCINFO_num("egid", value);
 
+	if (do_csv)
+		update_PROCINFO_num("CSV", 1);
+
 	switch (current_field_sep()) {
 	case Using_FIELDWIDTHS:
 		update_PROCINFO_str("FS", "FIELDWIDTHS");
@@ -1368,7 +1384,14 @@ catchsig(int sig)
 {
 	if (sig == SIGFPE) {
 		fatal(_("floating point exception"));
-	} else if (sig == SIGSEGV
+	}
+#ifdef SIGBUS
+	if (sig == SIGBUS) {
+		(void) signal(SIGBUS, catchsig);	/* for old SysV signal() */
+		input_map_fault();	/* returns if not a truncated input file */
+	}
+#endif
+	if (sig == SIGSEGV
 #ifdef SIGBUS
 	        || sig == SIGBUS
 #endif
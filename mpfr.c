@@ -85,6 +85,7 @@ init_mpfr(mpfr_prec_t prec, const char *rmode)
 	ROUND_MODE = get_rnd_mode(rmode[0]);
 	mpfr_set_default_rounding_mode(ROUND_MODE);
 	make_number = mpg_make_number;
+	make_unshared_number = mpg_make_number;
 	str2number = mpg_force_number;
 	format_val = mpg_format_val;
 	cmp_numbers = mpg_cmp;
@@ -30,10 +30,13 @@
 
 static int is_ieee_magic_val(const char *val);
 static NODE *r_make_number(double x);
+static NODE *r_make_unshared_number(double x);
 static AWKNUM get_ieee_magic_val(const char *val);
+static bool simple_strtod(const char *cp, const char *cpend, AWKNUM *result);
 extern NODE **fmt_list;          /* declared in eval.c */
 
 NODE *(*make_number)(double) = r_make_number;
+NODE *(*make_unshared_number)(double) = r_make_unshared_number;
 NODE *(*str2number)(NODE *) = r_force_number;
 NODE *(*format_val)(const char *, int, NODE *) = r_format_val;
 int (*cmp_numbers)(const NODE *, const NODE *) = cmp_awknums;
@@ -128,6 +131,12 @@ r_force_number(NODE *n)
 		}
 	}
 
+	if (simple_strtod(cp, cpend, & n->numbr)) {
+		n->flags |= newflags;
+		n->flags |= NUMCUR;
+		return n;
+	}
+
 	errno = 0;
 	save = *cpend;
 	*cpend = '\0';
@@ -168,6 +177,147 @@ static const char *values[] = {
 };
 #define	NVAL	(sizeof(values)/sizeof(values[0]))
 
+/*
+ * Powers of ten that are exact as doubles.  A mantissa of at most 15
+ * digits is exact too, so a single multiplication or division by one
+ * of these is correctly rounded, just as strtod() would give.
+ */
+static const double exact_pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+#define MAX_EXACT_POW10	22
+#define MAX_EXACT_DIGITS	15
+
+/*
+ * simple_strtod --- convert a plain decimal number without strtod().
+ *
+ * Handles [+-]digits[.digits][e[+-]digits] followed by nothing but
+ * white space, when the result is sure to be exact.  Anything else,
+ * including hex, inf and nan, is left for strtod().
+ */
+
+static bool
+simple_strtod(const char *cp, const char *cpend, AWKNUM *result)
+{
+	double mant = 0;
+	int ndigits = 0;	/* significant digits */
+	int exp10 = 0;
+	int e;
+	bool neg = false, eneg = false, seen = false;
+
+	if (*cp == '+' || *cp == '-')
+		neg = (*cp++ == '-');
+
+	for (; cp < cpend && isdigit((unsigned char) *cp); cp++) {
+		if (mant != 0 || *cp != '0')
+			ndigits++;
+		mant = mant * 10 + (*cp - '0');
+		seen = true;
+	}
+	if (cp < cpend && *cp == '.') {
+		/* the locale's decimal point may not be `.' */
+		if (use_lc_numeric)
+			return false;
+		for (cp++; cp < cpend && isdigit((unsigned char) *cp); cp++) {
+			if (mant != 0 || *cp != '0')
+				ndigits++;
+			mant = mant * 10 + (*cp - '0');
+			exp10--;
+			seen = true;
+		}
+	}
+	if (! seen || ndigits > MAX_EXACT_DIGITS)
+		return false;
+
+	if (cp < cpend && (*cp == 'e' || *cp == 'E')) {
+		cp++;
+		if (cp < cpend && (*cp == '+' || *cp == '-'))
+			eneg = (*cp++ == '-');
+		if (cp == cpend || ! isdigit((unsigned char) *cp))
+			return false;
+		for (e = 0; cp < cpend && isdigit((unsigned char) *cp); cp++) {
+			if (e > 1000)
+				return false;
+			e = e * 10 + (*cp - '0');
+		}
+		exp10 += (eneg ? -e : e);
+	}
+
+	/* POSIX says trailing space is OK for NUMBER */
+	while (cp < cpend && isspace((unsigned char) *cp))
+		cp++;
+	if (cp != cpend)
+		return false;
+
+	if (mant == 0)
+		exp10 = 0;
+	if (exp10 < -MAX_EXACT_POW10 || exp10 > MAX_EXACT_POW10)
+		return false;
+	if (exp10 < 0)
+		mant /= exact_pow10[-exp10];
+	else
+		mant *= exact_pow10[exp10];
+	*result = neg ? -mant : mant;
+	return true;
+}
+
+/* format_long --- write num in decimal, ending just before end */
+
+static char *
+format_long(long num, char *end)
+{
+	unsigned long uval;
+
+	/* negate as unsigned so that LONG_MIN doesn't overflow */
+	uval = (num < 0) ? - (unsigned long) num : (unsigned long) num;
+	*--end = '\0';
+	do {
+		*--end = '0' + (uval % 10);
+		uval /= 10;
+	} while (uval > 0);
+	if (num < 0)
+		*--end = '-';
+	return end;
+}
+
+/*
+ * plain_fmt[i] caches whether fmt_list[i] is a lone %e, %E, %f, %g or
+ * %G with no flags or width and at most a two digit precision. The C
+ * library formats those exactly as format_tree() would, and the result
+ * fits in the buffer of r_format_val(). 0 means not looked at yet.
+ */
+#define PLAIN_FMT_MAX	16
+static signed char plain_fmt[PLAIN_FMT_MAX];
+
+/* is_plain_fmt --- can format be handed to sprintf() as is? */
+
+static bool
+is_plain_fmt(const char *format, int index)
+{
+	const char *cp = format;
+	bool plain = false;
+
+	if (index >= 0 && index < PLAIN_FMT_MAX && plain_fmt[index] != 0)
+		return (plain_fmt[index] > 0);
+
+	if (*cp++ == '%') {
+		if (*cp == '.') {
+			cp++;
+			if (isdigit((unsigned char) *cp))
+				cp++;
+			if (isdigit((unsigned char) *cp))
+				cp++;
+		}
+		plain = (*cp != '\0' && strchr("eEfgG", *cp) != NULL
+				&& cp + 1 - format == fmt_list[index]->stlen);
+	}
+
+	if (index >= 0 && index < PLAIN_FMT_MAX)
+		plain_fmt[index] = (plain ? 1 : -1);
+	return plain;
+}
+
 /* r_format_val --- format a numeric value based on format */
 
 NODE *
@@ -198,6 +348,22 @@ r_format_val(const char *format, int index, NODE *s)
 	if ((val = double_to_int(s->numbr)) != s->numbr
 			|| val <= LONG_MIN || val >= LONG_MAX
 	) {
+		if (val == s->numbr || is_plain_fmt(format, index)) {
+			/*
+			 * Skip format_tree() when the C library does the same:
+			 * an integral value outside the range of %ld uses %.0f.
+			 */
+			if (val == s->numbr) {
+				(void) sprintf(sp, "%.0f", s->numbr);
+				s->stfmt = -1;
+			} else {
+				(void) sprintf(sp, format, s->numbr);
+				s->stfmt = (char) index;
+			}
+			s->stlen = strlen(sp);
+			goto copy;
+		}
+
 		/*
 		 * Once upon a time, we just blindly did this:
 		 *	sprintf(sp, format, s->numbr);
@@ -214,15 +380,9 @@ r_format_val(const char *format, int index, NODE *s)
 		dummy[1] = s;
 		oflags = s->flags;
 
-		if (val == s->numbr) {
-			/* integral value, but outside range of %ld, use %.0f */
-			r = format_tree("%.0f", 4, dummy, 2);
-			s->stfmt = -1;
-		} else {
-			r = format_tree(format, fmt_list[index]->stlen, dummy, 2);
-			assert(r != NULL);
-			s->stfmt = (char) index;
-		}
+		r = format_tree(format, fmt_list[index]->stlen, dummy, 2);
+		assert(r != NULL);
+		s->stfmt = (char) index;
 		s->flags = oflags;
 		s->stlen = r->stlen;
 		if ((s->flags & STRCUR) != 0)
@@ -236,25 +396,37 @@ r_format_val(const char *format, int index, NODE *s)
 		 * integral value; force conversion to long only once.
 		 */
 		long num = (long) val;
+		size_t len;
 
 		if (num < NVAL && num >= 0) {
 			sp = (char *) values[num];
-			s->stlen = 1;
+			len = 1;
 		} else {
-			(void) sprintf(sp, "%ld", num);
-			s->stlen = strlen(sp);
+			sp = format_long(num, buf + sizeof(buf));
+			len = buf + sizeof(buf) - 1 - sp;
 		}
 		s->stfmt = -1;
 		if (s->flags & INTIND) {
 			s->flags &= ~(INTIND|NUMBER);
 			s->flags |= STRING;
 		}
+
+		/*
+		 * Keep a string that is already right: the node may be
+		 * shared, and array subscripts point into its buffer.
+		 */
+		if ((s->flags & STRCUR) != 0 && s->stlen == len
+				&& memcmp(s->stptr, sp, len) == 0)
+			return s;
+		s->stlen = len;
 	}
+copy:
 	if (s->stptr != NULL)
 		efree(s->stptr);
 	emalloc(s->stptr, char *, s->stlen + 2, "format_val");
 	memcpy(s->stptr, sp, s->stlen + 1);
 no_malloc:
+	s->flags &= ~STRCAP;
 	s->flags |= STRCUR;
 	free_wstr(s);
 	return s;
@@ -293,7 +465,7 @@ r_dupnode(NODE *n)
 
 	getnode(r);
 	*r = *n;
-	r->flags &= ~FIELD;
+	r->flags &= ~(FIELD|STRCAP);
 	r->flags |= MALLOC;
 	r->valref = 1;
 #if MBS_SUPPORT
@@ -324,10 +496,48 @@ r_dupnode(NODE *n)
 	return r;
 }
 
-/* r_make_number --- allocate a node with defined number */
+/*
+ * Small integers are by far the most common numbers in awk programs:
+ * counters, field numbers, lengths, the results of comparisons.  Each
+ * one gets a single node, made the first time the value is needed and
+ * kept for good (the table holds a reference, so the count never drops
+ * to zero), whose string value, once computed, is kept as well.
+ */
+
+#define SMALL_INT_MIN	(-1024)
+#define SMALL_INT_MAX	65535
+
+static NODE *small_ints[SMALL_INT_MAX - SMALL_INT_MIN + 1];
+
+/* r_make_number --- return a node with defined number, shared if small */
 
 static NODE *
 r_make_number(double x)
+{
+	NODE *r;
+	long num;
+
+	if (! (x >= SMALL_INT_MIN && x <= SMALL_INT_MAX)	/* or NaN */
+			|| (num = (long) x) != x
+			|| (num == 0 && 1.0 / x < 0))	/* -0 keeps its sign */
+		return r_make_unshared_number(x);
+
+	r = small_ints[num - SMALL_INT_MIN];
+	if (r == NULL) {
+		r = small_ints[num - SMALL_INT_MIN] = r_make_unshared_number(x);
+		r->flags |= NUMINT;
+	}
+	r->valref++;
+	return r;
+}
+
+/*
+ * r_make_unshared_number --- allocate a node with defined number, for
+ * callers that go on to change the node in place.
+ */
+
+static NODE *
+r_make_unshared_number(double x)
 {
 	NODE *r;
 	getnode(r);
@@ -449,6 +659,28 @@ make_str_node(const char *s, size_t len, int flags)
 	return r;
 }
 
+/*
+ * make_char_node --- return the shared node for the one-byte string c.
+ * Only for values nobody changes in place: make_str_node() results get
+ * flags such as MAYBE_NUM added to them.
+ */
+
+NODE *
+make_char_node(int c)
+{
+	static NODE *char_nodes[UCHAR_MAX + 1];
+	char buf[1];
+	NODE *r;
+
+	c &= UCHAR_MAX;
+	if ((r = char_nodes[c]) == NULL) {
+		buf[0] = c;
+		r = char_nodes[c] = make_string(buf, 1);
+	}
+	r->valref++;
+	return r;
+}
+
 
 /* unref --- remove reference to a particular node */
 
@@ -817,6 +1049,7 @@ wstr2str(NODE *n)
 	efree(n->stptr);
 	n->stptr = newval;
 	n->stlen = cp - newval;
+	n->flags &= ~STRCAP;
 
 	return n;
 }
@@ -310,6 +310,438 @@ research(Regexp *rp, char *str, int start,
 	return res;
 }
 
+/*
+ * A scanner is a position (Glushkov) automaton for a regexp made only of
+ * characters, bracket expressions, `.', grouping, `|', `*', `+' and `?',
+ * with at most 64 character positions.  Each position is one bit of a
+ * uint64_t, so all the states move forward over a character with a few
+ * ANDs and ORs.  fpat_parse_field() uses it to find the leftmost-longest
+ * match of FPAT in one pass, instead of calling re_search() for every
+ * field.  Anchors, intervals, back references, the GNU operators and
+ * IGNORECASE are left to the regex routines.  In a multibyte locale,
+ * only UTF-8 is handled, and then only patterns that are all ASCII and
+ * don't use character classes.
+ */
+
+struct re_scanner {
+	uint64_t posmask[256];	/* positions each byte can match */
+	uint64_t follow[64];	/* positions that can come after each one */
+	uint64_t first;		/* positions that can start a match */
+	uint64_t last;		/* positions that can end a match */
+	bool nullable;		/* matches the null string */
+	bool utf8;		/* step over UTF-8 characters, not bytes */
+	int npos;		/* positions used */
+};
+
+struct scan_frag {
+	uint64_t first;
+	uint64_t last;
+	bool nullable;
+};
+
+struct scan_parse {
+	struct re_scanner *sc;
+	const char *s;
+	const char *end;
+};
+
+static bool scan_alt(struct scan_parse *sp, struct scan_frag *f);
+
+/* scan_escape --- the character for \c, or -1 if the scanner can't do it */
+
+static int
+scan_escape(int c)
+{
+	switch (c) {
+	case 'a':	return '\a';
+	case 'b':	return '\b';
+	case 'f':	return '\f';
+	case 'n':	return '\n';
+	case 'r':	return '\r';
+	case 't':	return '\t';
+	case 'v':	return '\v';
+	}
+	/* octal, hex, and the GNU operators */
+	if (isalnum(c) || c == '`' || c == '\'' || c == '<' || c == '>')
+		return -1;
+	return c & 0xFF;
+}
+
+/* follow_all --- every position in from can be followed by those in to */
+
+static void
+follow_all(struct re_scanner *sc, uint64_t from, uint64_t to)
+{
+	for (; from != 0; from &= from - 1)
+		sc->follow[lowest_bit(from)] |= to;
+}
+
+/* scan_position --- add a position matching the bytes in cls */
+
+static bool
+scan_position(struct scan_parse *sp, const uint64_t cls[4], bool nonascii,
+		struct scan_frag *f)
+{
+	struct re_scanner *sc = sp->sc;
+	uint64_t bit;
+	int c;
+
+	if (sc->npos == 64)
+		return false;
+	bit = (uint64_t) 1 << sc->npos++;
+	for (c = 0; c < 256; c++) {
+		if (sc->utf8 && c >= 0x80) {
+			if (nonascii)
+				sc->posmask[c] |= bit;
+		} else if ((cls[c >> 6] & ((uint64_t) 1 << (c & 63))) != 0)
+			sc->posmask[c] |= bit;
+	}
+	f->first = f->last = bit;
+	f->nullable = false;
+	return true;
+}
+
+/* scan_class --- add the bytes in [:name:] to cls */
+
+static bool
+scan_class(const char *name, size_t len, uint64_t cls[4])
+{
+	static const struct {
+		const char *name;
+		int (*func)(int);
+	} classes[] = {
+		{ "alpha", isalpha },
+		{ "digit", isdigit },
+		{ "alnum", isalnum },
+		{ "upper", isupper },
+		{ "lower", islower },
+		{ "space", isspace },
+		{ "punct", ispunct },
+		{ "print", isprint },
+		{ "graph", isgraph },
+		{ "cntrl", iscntrl },
+		{ "xdigit", isxdigit },
+		{ "blank", NULL },
+	};
+	int i, c;
+
+	for (i = 0; i < sizeof(classes) / sizeof(classes[0]); i++) {
+		if (strlen(classes[i].name) != len
+		    || strncmp(classes[i].name, name, len) != 0)
+			continue;
+		for (c = 0; c < 256; c++) {
+			if (classes[i].func != NULL ? classes[i].func(c)
+						    : (c == ' ' || c == '\t'))
+				cls[c >> 6] |= (uint64_t) 1 << (c & 63);
+		}
+		return true;
+	}
+	return false;
+}
+
+/* scan_bracket --- parse a bracket expression, after the [ */
+
+static bool
+scan_bracket(struct scan_parse *sp, struct scan_frag *f)
+{
+	uint64_t cls[4] = { 0, 0, 0, 0 };
+	bool negate = false;
+	bool first = true;
+	const char *cp;
+	int c, lo, hi;
+
+	if (sp->s < sp->end && *sp->s == '^') {
+		negate = true;
+		sp->s++;
+	}
+	for (;;) {
+		if (sp->s >= sp->end)
+			return false;
+		c = *sp->s++ & 0xFF;
+		if (c == ']' && ! first)
+			break;
+		first = false;
+		if (c == '[' && sp->s < sp->end
+		    && (*sp->s == ':' || *sp->s == '.' || *sp->s == '=')) {
+			if (*sp->s != ':' || sp->sc->utf8)
+				return false;
+			for (cp = ++sp->s; cp + 1 < sp->end; cp++)
+				if (cp[0] == ':' && cp[1] == ']')
+					break;
+			if (cp + 1 >= sp->end || ! scan_class(sp->s, cp - sp->s, cls))
+				return false;
+			sp->s = cp + 2;
+			continue;
+		}
+		if (c == '\\') {
+			if (sp->s >= sp->end || (c = scan_escape(*sp->s++)) < 0)
+				return false;
+		}
+		lo = hi = c;
+		if (sp->s + 1 < sp->end && sp->s[0] == '-' && sp->s[1] != ']') {
+			hi = sp->s[1] & 0xFF;
+			sp->s += 2;
+			if (hi == '[')
+				return false;
+			if (hi == '\\') {
+				if (sp->s >= sp->end || (hi = scan_escape(*sp->s++)) < 0)
+					return false;
+			}
+			if (hi < lo)
+				return false;
+		}
+		if (sp->sc->utf8 && hi >= 0x80)
+			return false;
+		for (c = lo; c <= hi; c++)
+			cls[c >> 6] |= (uint64_t) 1 << (c & 63);
+	}
+	if (negate) {
+		cls[0] = ~cls[0];
+		cls[1] = ~cls[1];
+		cls[2] = ~cls[2];
+		cls[3] = ~cls[3];
+	}
+	return scan_position(sp, cls, negate, f);
+}
+
+/* scan_atom --- parse a character, bracket expression, `.' or group */
+
+static bool
+scan_atom(struct scan_parse *sp, struct scan_frag *f)
+{
+	uint64_t cls[4] = { 0, 0, 0, 0 };
+	int c;
+
+	c = *sp->s++ & 0xFF;
+	switch (c) {
+	case '(':
+		if (! scan_alt(sp, f) || sp->s >= sp->end || *sp->s != ')')
+			return false;
+		sp->s++;
+		return true;
+	case '[':
+		return scan_bracket(sp, f);
+	case '.':
+		cls[0] = cls[1] = cls[2] = cls[3] = ~ (uint64_t) 0;
+		return scan_position(sp, cls, true, f);
+	case '\\':
+		if (sp->s >= sp->end || (c = scan_escape(*sp->s++)) < 0)
+			return false;
+		break;
+	case ')': case '*': case '+': case '?':
+	case '{': case '}': case '^': case '$': case '|':
+		return false;
+	default:
+		if (sp->sc->utf8 && c >= 0x80)
+			return false;
+		break;
+	}
+	cls[c >> 6] |= (uint64_t) 1 << (c & 63);
+	return scan_position(sp, cls, false, f);
+}
+
+/* scan_seq --- parse a sequence of atoms, each maybe with *, + or ? */
+
+static bool
+scan_seq(struct scan_parse *sp, struct scan_frag *f)
+{
+	struct re_scanner *sc = sp->sc;
+	struct scan_frag g;
+	bool empty = true;
+	int c;
+
+	while (sp->s < sp->end && *sp->s != '|' && *sp->s != ')') {
+		if (! scan_atom(sp, & g))
+			return false;
+		while (sp->s < sp->end
+		       && ((c = *sp->s) == '*' || c == '+' || c == '?')) {
+			sp->s++;
+			if (c != '?')
+				follow_all(sc, g.last, g.first);
+			if (c != '+')
+				g.nullable = true;
+		}
+		if (empty) {
+			*f = g;
+			empty = false;
+			continue;
+		}
+		follow_all(sc, f->last, g.first);
+		if (f->nullable)
+			f->first |= g.first;
+		if (g.nullable)
+			f->last |= g.last;
+		else
+			f->last = g.last;
+		f->nullable = (f->nullable && g.nullable);
+	}
+	return ! empty;
+}
+
+/* scan_alt --- parse alternatives */
+
+static bool
+scan_alt(struct scan_parse *sp, struct scan_frag *f)
+{
+	struct scan_frag g;
+
+	if (! scan_seq(sp, f))
+		return false;
+	while (sp->s < sp->end && *sp->s == '|') {
+		sp->s++;
+		if (! scan_seq(sp, & g))
+			return false;
+		f->first |= g.first;
+		f->last |= g.last;
+		f->nullable = (f->nullable || g.nullable);
+	}
+	return true;
+}
+
+/* make_scanner --- give rp a scanner for the regexp s, if it's simple enough */
+
+void
+make_scanner(Regexp *rp, const char *s, size_t len)
+{
+	struct re_scanner *sc;
+	struct scan_parse sp;
+	struct scan_frag f;
+
+	if (len == 0 || (gawk_mb_cur_max > 1 && ! byte_is_char('A')))
+		return;		/* nothing to do, or not UTF-8 */
+
+	emalloc(sc, struct re_scanner *, sizeof(struct re_scanner), "make_scanner");
+	memset(sc, 0, sizeof(struct re_scanner));
+	sc->utf8 = (gawk_mb_cur_max > 1);
+	sp.sc = sc;
+	sp.s = s;
+	sp.end = s + len;
+	if (scan_alt(& sp, & f) && sp.s == sp.end) {
+		sc->first = f.first;
+		sc->last = f.last;
+		sc->nullable = f.nullable;
+		rp->scanner = sc;
+	} else
+		efree(sc);
+}
+
+/*
+ * scan_char_len --- length of the character at s, as the scanner sees it.
+ * Return 0 if it isn't a valid UTF-8 character.  What matches those is
+ * up to the regex routines, and they don't always agree with themselves.
+ */
+
+static inline size_t
+scan_char_len(const struct re_scanner *sc, const unsigned char *s, size_t len)
+{
+	size_t n, i;
+	unsigned char lo = 0x80, hi = 0xBF;
+
+	if (! sc->utf8 || s[0] < 0x80)
+		return 1;
+	if (s[0] < 0xC2 || s[0] > 0xF4)
+		return 0;
+	n = (s[0] < 0xE0 ? 2 : s[0] < 0xF0 ? 3 : 4);
+	if (n > len)
+		return 0;
+	/* no overlong forms, surrogates, or values past 0x10FFFF */
+	if (s[0] == 0xE0)
+		lo = 0xA0;
+	else if (s[0] == 0xED)
+		hi = 0x9F;
+	else if (s[0] == 0xF0)
+		lo = 0x90;
+	else if (s[0] == 0xF4)
+		hi = 0x8F;
+	if (s[1] < lo || s[1] > hi)
+		return 0;
+	for (i = 2; i < n; i++)
+		if ((s[i] & 0xC0) != 0x80)
+			return 0;
+	return n;
+}
+
+/*
+ * scan_longest --- end of the longest match starting at s[i], -1 if
+ * there isn't one, or -2 if the scanner can't tell.  Each character
+ * looked at uses up one step of *steps; -2 also means they ran out.
+ */
+
+static long
+scan_longest(const struct re_scanner *sc, const unsigned char *s, size_t len, size_t i,
+		size_t *steps)
+{
+	long best = (sc->nullable ? (long) i : -1);
+	uint64_t reach = sc->first;
+	uint64_t d;
+	size_t clen;
+
+	for (; i < len; i += clen) {
+		if (*steps == 0)
+			return -2;
+		--*steps;
+		if ((clen = scan_char_len(sc, s + i, len - i)) == 0)
+			return -2;
+		if ((d = reach & sc->posmask[s[i]]) == 0)
+			break;
+		if ((d & sc->last) != 0)
+			best = i + clen;
+		for (reach = 0; d != 0; d &= d - 1)
+			reach |= sc->follow[lowest_bit(d)];
+	}
+	return best;
+}
+
+/*
+ * scan_regexp --- find the leftmost-longest match of rp in str with its
+ * scanner.  Return the offset of the start, and the end in *endp, or -1.
+ * Return -2 if the text has invalid characters, or if trying a match
+ * at each position gets too slow, and research() should decide instead.
+ */
+
+/* characters looked at, per character of text, before giving up */
+#define SCAN_STEPS	8
+
+int
+scan_regexp(Regexp *rp, const char *str, size_t len, size_t *endp)
+{
+	const struct re_scanner *sc = rp->scanner;
+	const unsigned char *s = (const unsigned char *) str;
+	size_t i, clen;
+	size_t steps = SCAN_STEPS * len + 64;
+	long e;
+
+	for (i = 0; ; i += clen) {
+		if (sc->nullable
+		    || (i < len && (sc->posmask[s[i]] & sc->first) != 0)) {
+			if ((e = scan_longest(sc, s, len, i, & steps)) == -2)
+				return -2;
+			if (e >= 0) {
+				*endp = e;
+				return i;
+			}
+		}
+		if (i >= len)
+			return -1;
+		if ((clen = scan_char_len(sc, s + i, len - i)) == 0)
+			return -2;
+	}
+}
+
+/*
+ * scanner_useful --- return true if scan_regexp() should be used to split
+ * str.  The scanner tries for a match at each position in turn, which
+ * takes quadratic time on a long string with no match at all.  One pass
+ * of the dfa is enough to find that out, unless the null string matches.
+ */
+
+bool
+scanner_useful(Regexp *rp, char *str, size_t len)
+{
+	return (rp->scanner != NULL
+		&& (rp->scanner->nullable || research(rp, str, 0, len, 0) != -1));
+}
+
 /* refree --- free up the dynamic memory used by a compiled regexp */
 
 void
@@ -327,6 +759,8 @@ refree(Regexp *rp)
 		dfafree(rp->dfareg);
 		free(rp->dfareg);
 	}
+	if (rp->scanner)
+		efree(rp->scanner);
 	efree(rp);
 }
 
@@ -38,6 +38,7 @@ static void (*install_func)(NODE *) = NULL;
 static NODE *make_symbol(char *name, NODETYPE type);
 static NODE *install(char *name, NODE *parm, NODETYPE type);
 static void free_bcpool(INSTRUCTION *pl);
+static void free_bc_internal(INSTRUCTION *cp);
 
 static AWK_CONTEXT *curr_ctxt = NULL;
 static int ctxt_level;
@@ -629,6 +630,21 @@ bcfree(INSTRUCTION *cp)
 	pool_list->freei = cp;
 }	
 
+/* free_bc_list --- deallocate a list of instructions that will never run */
+
+void
+free_bc_list(INSTRUCTION *list)
+{
+	INSTRUCTION *cp, *next;
+
+	for (cp = list->nexti; cp != NULL; cp = next) {
+		next = (cp == list->lasti ? NULL : cp->nexti);
+		free_bc_internal(cp);
+		bcfree(cp);
+	}
+	bcfree(list);
+}
+
 /* bcalloc --- allocate a new instruction */
 
 INSTRUCTION *
@@ -795,6 +811,10 @@ free_bc_internal(INSTRUCTION *cp)
 		if (cp->func_name != NULL)
 			efree(cp->func_name);
 		break;
+	case Op_indirect_func_call:
+		if ((cp + 1)->call_cache != NULL)
+			free_indirect_cache((cp + 1)->call_cache);
+		break;
 	case Op_push_re:
 	case Op_match_rec:
 	case Op_match:
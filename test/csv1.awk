@@ -0,0 +1,19 @@
+# Test --csv field splitting
+{
+	printf("%d:", NF)
+	for (i = 1; i <= NF; i++)
+		printf(" <%s>", $i)
+	print ""
+}
+
+END {
+	n = split("a,\"b,c\",,\"d\"\"\"", f)
+	printf("split: %d", n)
+	for (i = 1; i <= n; i++)
+		printf(" <%s>", f[i])
+	print ""
+	$0 = "x,\"y, z\",w"
+	$2 = "Y"
+	print NF, $0
+	print PROCINFO["CSV"]
+}
@@ -0,0 +1,7 @@
+# Test --csv record splitting
+{
+	gsub(/\r/, "\\r")
+	gsub(/\n/, "\\n")
+	rt = (RT == "\r\n" ? "CRLF" : RT == "\n" ? "NL" : "none")
+	printf("%d %s %d [%s] <%s>\n", NR, rt, NF, $0, $2)
+}
@@ -0,0 +1,55 @@
+# Constant folding and dead code removal with -O; the results must be
+# the same as without it.
+
+function f(x) {
+	return x * 2
+	print "not reached in f"
+}
+
+BEGIN {
+	print length("abc"), length(""), length("a b")
+	print substr("hello", 2, 3) "|" substr("hello", 0, 2) "|" substr("hello", 3) "|" substr("hello", 9) "|" substr("hello", 2, 0) "|" substr("hello", 2, 1e10) "|" substr("", 1)
+	print substr("hello", 1.5, 2.7), substr("hello", -1, 3)
+	print sprintf("%5.2f|%-4d|%s|%x|%c|%%|%05d", 3.14159, 42, "str", 255, "xyz", -7)
+	print (1 < 2), (2 <= 1), (3 == 3), (3 != 3), (10 > 9), (1 >= 2), (2 == 2.0)
+	print ("10" < "9"), (1e308 * 10 == 1e308 * 10)
+
+	# these depend on run-time settings and are not folded
+	CONVFMT = "%.2g"
+	print sprintf("%s", 3.14159), sprintf("%d %s", "0x11", 17), sprintf("%*d", 4, 1)
+	IGNORECASE = 1
+	print ("ABC" == "abc"), ("FOO" ~ "foo"), match("xFOOx", "o+")
+	IGNORECASE = 0
+
+	if (0) print "not reached 1"; else print "else taken"
+	if ("") print "not reached 2"
+	if ("0") print "string \"0\" is true"
+	if (1 - 1) print "not reached 3"
+	print (1 ? "yes" : "no"), (0 ? "yes" : "no"), ("" ? "yes" : "no")
+
+	s = "foobar"
+	print (s ~ "^foo"), (s ~ "o|z"), (s !~ "x.r"), (s ~ "(b)"), match(s, "bar") RSTART
+	n = gsub("o", "0", s); print n, s
+	split("a.b.c", a, "."); print a[2]
+	split("a b  c", a, " "); print a[3]
+
+	for (i = 1; i <= 3; i++) {
+		if (i == 2) {
+			continue
+			print "not reached 4"
+		}
+		print "i =", i
+	}
+	print f(21)
+
+	# a zero divisor is an error only if the division is done
+	if (x)
+		print 1 / 0, 1 % 0
+	print "no division"
+	exit
+	print "not reached 5"
+}
+
+END {
+	print "end"
+}
@@ -0,0 +1,51 @@
+# FPAT and patsplit() with patterns simple enough for the position
+# automaton in re.c, and with some that it hands back to the regex
+# routines: more than 64 character positions, and long text with no
+# match at all.  Where alternatives tie, the longest match must win.
+
+function show(pat, str,		n, i, f, s, out)
+{
+	n = patsplit(str, f, pat, s)
+	out = sprintf("%s / %s: %d <%s>", pat, str, n, s[0])
+	for (i = 1; i <= n; i++)
+		out = out sprintf(" [%s]<%s>", f[i], s[i])
+	print out
+}
+
+# lengths --- like show(), for strings too long to print
+
+function lengths(pat, str,		n, i, f, s, out)
+{
+	n = patsplit(str, f, pat, s)
+	out = sprintf("%s / %d: %d <%d>", pat, length(str), n, length(s[0]))
+	for (i = 1; i <= n; i++)
+		out = out sprintf(" [%d]<%d>", length(f[i]), length(s[i]))
+	print out
+}
+
+BEGIN {
+	# leftmost-longest
+	show("a|ab", "abab xab")
+	show("ab|a", "abab xab")
+	show("(a|ab)(c|bcd)", "abcd abc")
+	show("x(a|ab)*", "xababa xaab")
+	show("[0-9]+(\\.[0-9]*)?|\\.[0-9]+", "1.5 .25 7. 42")
+	show("b*", "abbcb")
+	show("(ab|a)(bc|c)?", "abc ac ab")
+	show("\"[^\"]*\"|[^,]+", "a,\"b,c\",,d")
+
+	# more than 64 positions
+	words = "alpha|bravo|charlie|delta|echo|foxtrot|golf|hotel|india|juliet|kilo|lima|mike|november"
+	show("(" words ")+", "a limahotel, echoecho kilo-golf")
+
+	# no match in a long string, or only at its end
+	long = sprintf("%30000s", "")
+	gsub(/ /, "a", long)
+	lengths("a*b", "x b " long)
+	lengths("a*b", long "c" long "b")
+	lengths("a*c", long)
+}
+
+# the same on records, one field at a time and then all of them
+BEGIN { FPAT = "[a-z]+|[0-9]+" }
+{ print NR ": " $2 " " NF " " $NF }
@@ -0,0 +1,16 @@
+# A number whose string value has been computed is still a number
+# when assigned to IGNORECASE.
+
+BEGIN {
+	x = 1 - 1
+	print x
+	IGNORECASE = x
+	print ("A" ~ /a/)
+	IGNORECASE = (2 > 1)
+	print ("A" ~ /a/)
+	print (1 > 2)
+	IGNORECASE = (1 > 2)
+	print ("A" ~ /a/)
+	IGNORECASE = "0"
+	print ("A" ~ /a/)
+}
@@ -0,0 +1,31 @@
+# Indirect calls through a table of more functions than the
+# per-call-site cache holds, and names that come from fields.
+
+function f1(x) { return "f1(" x ")" }
+function f2(x) { return "f2(" x ")" }
+function f3(x) { return "f3(" x ")" }
+function f4(x) { return "f4(" x ")" }
+function f5(x) { return "f5(" x ")" }
+function f6(x) { return "f6(" x ")" }
+function f7(x) { return "f7(" x ")" }
+function f8(x) { return "f8(" x ")" }
+function f9(x) { return "f9(" x ")" }
+function f10(x) { return "f10(" x ")" }
+
+BEGIN {
+	for (i = 1; i <= 10; i++)
+		handler[i] = "f" i
+	for (j = 0; j < 3; j++) {
+		s = ""
+		for (i = 10; i >= 1; i--) {
+			f = handler[i]
+			s = s @f(j)
+		}
+		print s
+	}
+}
+
+{
+	f = $1
+	print @f($2)
+}
@@ -0,0 +1,76 @@
+# Calls to small functions are inlined with -O; check that they still
+# behave like calls.
+
+function max(a, b) { return a > b ? a : b }
+function trim(s) { sub(/^[ \t]+/, "", s); sub(/[ \t]+$/, "", s); return s }
+function sq(x,   t) { t = x * x; return t }
+function count(x) { seen[x]++; return seen[x] }
+function add(x) { total += x }
+function local(x,   l) { l = l "+" x; return l }
+function loop(n,   i, s) {
+	for (i = 1; i <= n; i++) {
+		if (i == 3)
+			continue
+		if (i > 6)
+			break
+		s += i
+	}
+	return s
+}
+function zero() { return "zero" }
+function len(x) { return length(x) }
+function unused(x) { return "unused" }
+function nf(n) { $n = "<" $n ">"; return NF }
+
+# a tail call that passes a local array
+function tail(n, a, loc) {
+	if (n == 0)
+		return length(a)
+	loc[n] = 1
+	return tail(n - 1, loc)
+}
+
+# a tail call that passes an untyped local, which the callee makes an
+# array or a scalar; the caller's untyped local follows it
+function tailu(n, u, loc) {
+	if (n == 0) {
+		u["x"] = n
+		return length(u)
+	}
+	return tailu(n - 1, loc)
+}
+function tails(n, v, loc) {
+	if (n == 0) {
+		v = "set"
+		return v
+	}
+	return tails(n - 1, loc)
+}
+function outer(	loc) { return tailu(2, loc) " " length(loc) }
+
+BEGIN {
+	print max(3, 7), max("b", "a"), trim("  hi there  ") "|"
+	print sq(5), sq(), count("a"), count("a")
+	add(5); add(6); print total
+	print local(1), local(2)
+	print loop(10), zero(), len("abc"), len(nosuch)
+	print max(max(1, 9), max(4, 2)), sq(sq(3))
+
+	v = "x"; w = trim(v); v = v "y"; print v, w
+
+	# an array for a parameter that is never used
+	arr[1]; print unused(arr)
+
+	# an untyped variable becomes a scalar, as with a real call
+	print max(untyped, 0) == ""
+	untyped = 5; print untyped
+
+	for (i = 0; i < 3; i++)
+		s = s max(i, 1)
+	print s
+
+	print tail(3, z)
+	print tailu(3, y), length(y), tails(3, q), q == "", outer()
+}
+
+{ print nf(2), $0 }
@@ -0,0 +1,21 @@
+# A file cut short while it is being read must not crash gawk, even
+# when it is mapped into memory.
+
+BEGIN {
+	file = "_mmaptrunc.data"
+	for (i = 1; i <= 50000; i++)
+		print "line", i > file
+	close(file)
+
+	while ((getline line < file) > 0) {
+		if (++n == 1) {
+			# rewriting it through another name truncates it
+			for (i = 1; i <= 10; i++)
+				print "line", i > ("./" file)
+			close("./" file)
+		}
+	}
+	close(file)
+	print (n >= 10), (n < 50000)
+	system("rm -f " file)
+}
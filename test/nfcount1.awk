@@ -0,0 +1,3 @@
+# NF is counted without splitting the record; run with and without -F:
+{ n += NF }
+END { print n }
@@ -0,0 +1,2 @@
+# NF is counted, then a field past the highest one parsed is assigned
+{ NF; $3 = "x"; print }
@@ -0,0 +1,2 @@
+# NF is counted, then assigned, which needs the counted fields
+{ print NF; NF = 2; print }
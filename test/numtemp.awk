@@ -0,0 +1,37 @@
+# Arithmetic stores its result in the node of a temporary that nothing
+# else refers to.  Values that are shared, by variables, array elements,
+# parameters or the table of small integers, must come through unchanged.
+
+function twice(p) { p = p * 2 + 0.5; return p }
+function local(	l) { l = 7.5 * 2; return l }
+
+BEGIN {
+	for (i = 1; i <= 3; i++)
+		print i, (i * 2 + 1) * 3 - i / 2, -(i * 1.5) ^ 2 % 4
+
+	x = 2.5 * 3
+	y = x + 1
+	z = -x
+	print x, y, z
+
+	a = 1 + 2
+	b = (1 + 2) * 5
+	print a, b, 1 + 2, -(1 + 2), 3
+
+	arr[1] = 1.5 * 3
+	c = -arr[1] * 2
+	print arr[1], c
+
+	v = 3.25
+	print v, twice(v), v
+
+	print local() + 1, local() * local()
+
+	p = q = 0.5 * 5
+	r = p + 1
+	print p, q, r
+
+	t = 2.5 * 2
+	u = t ""
+	print t + 1, u, t
+}
@@ -0,0 +1,28 @@
+# Test PROCINFO["READ_AHEAD"]; the results should be the same as
+# without it, for the main input and for getline from a pipe.
+
+BEGIN {
+	PROCINFO["READ_AHEAD"] = 1
+
+	cmd = "yes 'the quick brown fox jumps over the lazy dog' | head -n 30000"
+	while ((cmd | getline line) > 0) {
+		n++
+		len += length(line)
+	}
+	print n, len, close(cmd)
+
+	# records that straddle the helper's buffers
+	n = len = 0
+	RS = "\n+"
+	while ((cmd | getline) > 0) {
+		n++
+		len += length($0) + length(RT)
+		nf += NF
+	}
+	print n, len, nf, close(cmd)
+	RS = "\n"
+}
+
+{ print NR, NF, $1 }
+
+END { print "done" }
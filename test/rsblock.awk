@@ -0,0 +1,8 @@
+# Records whose terminators fall on and around the 64-byte blocks that
+# rs1scan() searches, read in small pieces so that the buffer is refilled
+# while a block is still cached: run with AWKBUFSIZE=100 and GAWK_NO_MMAP.
+# RS changes in the middle of a block, and back again.
+
+{ printf "%d: %d [%s]\n", NR, length($0), RT == "\n" ? "\\n" : RT }
+NR == 20 { RS = ";" }
+NR == 40 { RS = "\n" }
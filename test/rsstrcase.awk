@@ -0,0 +1,7 @@
+# Setting IGNORECASE must move a literal RS over to the regexp scanner,
+# and clearing it must move it back.
+
+BEGIN { RS = "ab" }
+{ printf "%d: [%s] [%s]\n", NR, $0, RT }
+NR == 2 { IGNORECASE = 1 }
+NR == 4 { IGNORECASE = 0 }
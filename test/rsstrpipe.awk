@@ -0,0 +1,5 @@
+# A literal multicharacter RS read from a pipe in 16-byte pieces, so that
+# many terminators straddle a refill.  Run with AWKBUFSIZE=16.
+
+BEGIN { RS = "-=-=-" }
+{ printf "%d: [%s] [%s]\n", NR, $0, RT }